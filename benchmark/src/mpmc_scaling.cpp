@@ -0,0 +1,143 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <chrono>      // steady_clock
+#include <cstdlib>     // EXIT_*
+#include <iomanip>     // setw(), setprecision()
+#include <iostream>    // cout
+#include <mutex>       // mutex, scoped_lock
+#include <string>      // string, stoull()
+#include <thread>      // thread, this_thread::yield()
+#include <vector>      // vector<T>
+
+#include "circ_array_queue.hpp"        // CircArrayQueue<T>
+#include "mpmc_ring_queue.hpp"         // MPMCRingQueue<T>
+#include "segmented_array_queue.hpp"   // SegmentedArrayQueue<T>
+
+using namespace std;
+using Clock = chrono::steady_clock;
+
+// CircArrayQueue guarded by a mutex, bounded like a ring queue
+class LockedQueue
+{
+    mutex                     mtx_ {};
+    dsa::CircArrayQueue<long> q_;
+    size_t                    cap_;
+
+public:
+    LockedQueue(size_t cap) : q_(cap), cap_ { cap } {}
+
+    bool try_enqueue(long elem) {
+        auto lock = scoped_lock { mtx_ };
+        if (q_.size() == cap_) return false;
+        q_.enqueue(elem);
+        return true;
+    }
+
+    bool try_dequeue(long& out) {
+        auto lock = scoped_lock { mtx_ };
+        if (q_.empty()) return false;
+        out = q_.front();
+        q_.dequeue();
+        return true;
+    }
+};
+
+// SegmentedArrayQueue, which has no capacity to fill up
+class UnboundedQueue
+{
+    dsa::SegmentedArrayQueue<long> q_ {};
+
+public:
+    UnboundedQueue(size_t) {}
+
+    bool try_enqueue(long elem) {
+        q_.enqueue(elem);
+        return true;
+    }
+
+    bool try_dequeue(long& out) { return q_.try_dequeue(out); }
+};
+
+// Passes `num_ops` elements from `num_threads` producer threads to as many
+// consumer threads through a queue of capacity `cap`, and returns the
+// throughput in millions of elements per second.
+template <typename Queue>
+double bench(size_t num_ops, size_t num_threads, size_t cap) {
+    auto       q       = Queue(cap);
+    auto const per_thr = num_ops / num_threads;
+    auto       threads = vector<thread> {};
+
+    auto const start = Clock::now();
+    for (size_t t { 0 }; t < num_threads; ++t) {
+        threads.emplace_back([&q, per_thr] {
+            for (size_t i { 0 }; i < per_thr;) {
+                if (q.try_enqueue(static_cast<long>(i))) ++i;
+                else this_thread::yield();
+            }
+        });
+        threads.emplace_back([&q, per_thr] {
+            for (size_t i { 0 }; i < per_thr;) {
+                long out;
+                if (q.try_dequeue(out)) ++i;
+                else this_thread::yield();
+            }
+        });
+    }
+    for (auto& thr : threads) thr.join();
+    auto const total = chrono::duration<double>(Clock::now() - start);
+
+    return per_thr * num_threads / total.count() / 1e6;
+}
+
+int main(int argc, char** argv) {
+    size_t num_ops { argc > 1 ? stoull(argv[1]) : size_t { 1 } << 22 };
+    size_t max_threads { argc > 2 ? stoull(argv[2]) : size_t { 64 } };
+    size_t cap { argc > 3 ? stoull(argv[3]) : size_t { 1024 } };
+    cout << "Pass " << num_ops << " elements from N producer threads to N "
+         << "consumer threads through a queue of capacity " << cap
+         << "...\n\n"
+         << "   N | mutex + CircArrayQueue<long> | MPMCRingQueue<long> | "
+         << "SegmentedArrayQueue<long>\n"
+         << fixed << setprecision(2);
+
+    for (size_t n { 1 }; n <= max_threads; n *= 2) {
+        auto const locked = bench<LockedQueue>(num_ops, n, cap);
+        auto const mpmc   = bench<dsa::MPMCRingQueue<long>>(num_ops, n, cap);
+        auto const seg    = bench<UnboundedQueue>(num_ops, n, cap);
+        cout << setw(4) << n << " | " << setw(21) << locked << " Mops/s | "
+             << setw(12) << mpmc << " Mops/s | " << setw(18) << seg
+             << " Mops/s\n";
+    }
+
+    return EXIT_SUCCESS;
+}
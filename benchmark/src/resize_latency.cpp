@@ -0,0 +1,103 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>     // max(), sort()
+#include <chrono>        // steady_clock
+#include <cstdlib>       // EXIT_*
+#include <iostream>      // cout
+#include <string>        // string, stoull()
+#include <type_traits>   // is_constructible_v<T, Args...>
+#include <vector>        // vector<T>
+
+#include "chunked_list_queue.hpp"      // ChunkedListQueue<T>
+#include "circ_array_queue.hpp"        // CircArrayQueue<T>
+#include "incr_circ_array_queue.hpp"   // IncrCircArrayQueue<T>
+
+using namespace std;
+using Clock = chrono::steady_clock;
+
+// Enqueues `num_ops` elements into an initially tiny queue, followed by
+// dequeuing all of them, and reports the latency distribution of the
+// operations, which is dominated by resizing in the worst case. Queues that
+// never resize, and so take no initial capacity, start empty instead.
+template <typename Queue, typename Elem>
+void bench(string const& label, size_t num_ops, Elem const& elem) {
+    auto q = [] {
+        if constexpr (is_constructible_v<Queue, size_t>) return Queue(1);
+        else return Queue();
+    }();
+    auto lats = vector<double> {};
+    lats.reserve(2 * num_ops);
+
+    auto const start = Clock::now();
+    for (size_t i { 0 }; i < num_ops; ++i) {
+        auto const t0 = Clock::now();
+        q.enqueue(elem);
+        lats.push_back(chrono::duration<double, micro>(Clock::now() - t0)
+                           .count());
+    }
+    for (size_t i { 0 }; i < num_ops; ++i) {
+        auto const t0 = Clock::now();
+        q.dequeue();
+        lats.push_back(chrono::duration<double, micro>(Clock::now() - t0)
+                           .count());
+    }
+    auto const total = chrono::duration<double, milli>(Clock::now() - start);
+
+    sort(lats.begin(), lats.end());
+    cout << label << " :: total: " << total.count() << " ms"
+         << " | p50: " << lats[lats.size() / 2] << " us"
+         << " | p99.99: " << lats[lats.size() * 9999 / 10000] << " us"
+         << " | max: " << lats.back() << " us\n";
+}
+
+int main(int argc, char** argv) {
+    size_t num_ops { argc > 1 ? stoull(argv[1]) : size_t { 1 } << 22 };
+    cout << "Enqueue then dequeue " << num_ops << " elements...\n\n";
+
+    bench<dsa::CircArrayQueue<long>>("CircArrayQueue<long>          ",
+                                     num_ops, 42L);
+    bench<dsa::IncrCircArrayQueue<long>>("IncrCircArrayQueue<long>      ",
+                                         num_ops, 42L);
+    bench<dsa::ChunkedListQueue<long>>("ChunkedListQueue<long>        ",
+                                       num_ops, 42L);
+
+    auto const word = string { "cppdsa-queue" };
+    bench<dsa::CircArrayQueue<string>>("CircArrayQueue<string>        ",
+                                       num_ops, word);
+    bench<dsa::IncrCircArrayQueue<string>>("IncrCircArrayQueue<string>    ",
+                                           num_ops, word);
+    bench<dsa::ChunkedListQueue<string>>("ChunkedListQueue<string>      ",
+                                         num_ops, word);
+
+    return EXIT_SUCCESS;
+}
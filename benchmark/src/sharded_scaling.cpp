@@ -0,0 +1,146 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>   // max()
+#include <chrono>      // steady_clock
+#include <cstdlib>     // EXIT_*
+#include <iomanip>     // setw(), setprecision()
+#include <iostream>    // cout
+#include <mutex>       // mutex, scoped_lock
+#include <string>      // stoull()
+#include <thread>      // thread
+#include <vector>      // vector<T>
+
+#include "circ_array_queue.hpp"        // CircArrayQueue<T>
+#include "segmented_array_queue.hpp"   // SegmentedArrayQueue<T>
+#include "sharded_queue.hpp"           // ShardedQueue<T>
+
+using namespace std;
+using Clock = chrono::steady_clock;
+
+// CircArrayQueue guarded by a single mutex
+class LockedQueue
+{
+    mutex                     mtx_ {};
+    dsa::CircArrayQueue<long> q_ {};
+
+public:
+    LockedQueue(size_t) {}
+
+    void enqueue(long elem) {
+        auto lock = scoped_lock { mtx_ };
+        q_.enqueue(elem);
+    }
+
+    bool try_dequeue(long& out) {
+        auto lock = scoped_lock { mtx_ };
+        if (q_.empty()) return false;
+        out = q_.front();
+        q_.dequeue();
+        return true;
+    }
+};
+
+// SegmentedArrayQueue, which has a single head and tail as well
+class SegmentedQueue
+{
+    dsa::SegmentedArrayQueue<long> q_ {};
+
+public:
+    SegmentedQueue(size_t) {}
+
+    void enqueue(long elem) { q_.enqueue(elem); }
+
+    bool try_dequeue(long& out) { return q_.try_dequeue(out); }
+};
+
+// ShardedQueue with a shard per thread
+class Sharded
+{
+    dsa::ShardedQueue<long> q_;
+
+public:
+    Sharded(size_t num_threads) : q_(num_threads) {}
+
+    void enqueue(long elem) { q_.enqueue(elem); }
+
+    bool try_dequeue(long& out) { return q_.try_dequeue(out); }
+};
+
+// Has each of `num_threads` threads add an element to a queue then remove
+// one, `num_ops` times in total, and returns the throughput in millions of
+// pairs of operations per second.
+template <typename Queue>
+double bench(size_t num_ops, size_t num_threads) {
+    auto       q       = Queue(num_threads);
+    auto const per_thr = num_ops / num_threads;
+    auto       threads = vector<thread> {};
+
+    auto const start = Clock::now();
+    for (size_t t { 0 }; t < num_threads; ++t) {
+        threads.emplace_back([&q, per_thr] {
+            long out;
+            for (size_t i { 0 }; i < per_thr; ++i) {
+                q.enqueue(static_cast<long>(i));
+                // Retried, as other threads may take every element left
+                while (!q.try_dequeue(out)) {}
+            }
+        });
+    }
+    for (auto& thr : threads) thr.join();
+    auto const total = chrono::duration<double>(Clock::now() - start);
+
+    return per_thr * num_threads / total.count() / 1e6;
+}
+
+int main(int argc, char** argv) {
+    size_t num_ops { argc > 1 ? stoull(argv[1]) : size_t { 1 } << 22 };
+    size_t max_threads { argc > 2 ? stoull(argv[2])
+                                  : max(thread::hardware_concurrency(), 1u) };
+    cout << "Add then remove an element " << num_ops << " times over N "
+         << "threads, on " << thread::hardware_concurrency()
+         << " hardware threads...\n\n"
+         << "   N | mutex + CircArrayQueue<long> | "
+         << "SegmentedArrayQueue<long> | ShardedQueue<long>\n"
+         << fixed << setprecision(2);
+
+    for (size_t n { 1 }; n <= max_threads; n *= 2) {
+        auto const locked  = bench<LockedQueue>(num_ops, n);
+        auto const seg     = bench<SegmentedQueue>(num_ops, n);
+        auto const sharded = bench<Sharded>(num_ops, n);
+        cout << setw(4) << n << " | " << setw(21) << locked << " Mops/s | "
+             << setw(18) << seg << " Mops/s | " << setw(11) << sharded
+             << " Mops/s\n";
+    }
+
+    return EXIT_SUCCESS;
+}
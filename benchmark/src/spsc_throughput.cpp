@@ -0,0 +1,114 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <chrono>      // steady_clock
+#include <cstdlib>     // EXIT_*
+#include <iostream>    // cout
+#include <mutex>       // mutex, scoped_lock
+#include <string>      // string, stoull()
+#include <thread>      // thread, this_thread::yield()
+
+#include "circ_array_queue.hpp"   // CircArrayQueue<T>
+#include "spsc_ring_queue.hpp"    // SPSCRingQueue<T>
+
+using namespace std;
+using Clock = chrono::steady_clock;
+
+// CircArrayQueue guarded by a mutex, bounded like a ring queue
+class LockedQueue
+{
+    mutex                     mtx_ {};
+    dsa::CircArrayQueue<long> q_;
+    size_t                    cap_;
+
+public:
+    LockedQueue(size_t cap) : q_(cap), cap_ { cap } {}
+
+    bool try_enqueue(long elem) {
+        auto lock = scoped_lock { mtx_ };
+        if (q_.size() == cap_) return false;
+        q_.enqueue(elem);
+        return true;
+    }
+
+    bool try_dequeue(long& out) {
+        auto lock = scoped_lock { mtx_ };
+        if (q_.empty()) return false;
+        out = q_.front();
+        q_.dequeue();
+        return true;
+    }
+};
+
+// Passes `num_ops` elements from a producer thread to a consumer thread
+// through a queue of capacity `cap`, and reports the throughput.
+template <typename Queue>
+void bench(string const& label, size_t num_ops, size_t cap) {
+    auto q = Queue(cap);
+
+    auto const start    = Clock::now();
+    auto       producer = thread { [&q, num_ops] {
+        for (size_t i { 0 }; i < num_ops;) {
+            if (q.try_enqueue(static_cast<long>(i))) ++i;
+            else this_thread::yield();
+        }
+    } };
+    long sum { 0 };
+    for (size_t i { 0 }; i < num_ops;) {
+        long out;
+        if (q.try_dequeue(out)) {
+            sum += out;
+            ++i;
+        } else {
+            this_thread::yield();
+        }
+    }
+    producer.join();
+    auto const total = chrono::duration<double>(Clock::now() - start);
+
+    cout << label << " :: total: " << total.count() * 1e3 << " ms"
+         << " | throughput: " << num_ops / total.count() / 1e6 << " Mops/s"
+         << " | checksum: " << sum << '\n';
+}
+
+int main(int argc, char** argv) {
+    size_t num_ops { argc > 1 ? stoull(argv[1]) : size_t { 1 } << 24 };
+    size_t cap { argc > 2 ? stoull(argv[2]) : size_t { 1024 } };
+    cout << "Pass " << num_ops << " elements from one thread to another "
+         << "through a queue of capacity " << cap << "...\n\n";
+
+    bench<LockedQueue>("mutex + CircArrayQueue<long>", num_ops, cap);
+    bench<dsa::SPSCRingQueue<long>>("SPSCRingQueue<long>         ", num_ops,
+                                    cap);
+
+    return EXIT_SUCCESS;
+}
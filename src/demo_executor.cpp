@@ -0,0 +1,136 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>     // atomic<T>
+#include <cstdlib>    // EXIT_*
+#include <iostream>   // cout, ostream
+#include <string>     // string
+#include <vector>     // vector<T>
+
+#include "work_stealing_executor.hpp"   // WorkStealingExecutor
+
+struct Job
+{
+    unsigned int time_id;              // unique ID as timestamp
+    unsigned int priority { 0 };       // job priority
+    std::string  name { "unnamed" };   // job name (non-unique)
+};
+
+std::ostream& operator<<(std::ostream& os, Job const& job) {
+    return os << "Job(name=" << job.name << ", time_id=" << job.time_id
+              << ", priority=" << job.priority << ")";
+}
+
+/**
+ * @brief Determines if a number is prime, by trial division.
+ *
+ * @param n The number to test.
+ * @return `true` if `n` is prime, `false` otherwise.
+ */
+bool is_prime(unsigned int n) {
+    if (n < 2) return false;
+    for (unsigned int d { 2 }; d * d <= n; ++d) {
+        if (n % d == 0) return false;
+    }
+    return true;
+}
+
+int main() {
+    using namespace std;
+
+    constexpr unsigned int range_size { 10'000 };
+    constexpr unsigned int chunk_size { 500 };
+
+    try {
+        auto pool = dsa::WorkStealingExecutor(4);
+
+        cout << "Running jobs on " << pool.num_workers() << " workers...\n"
+             << endl;
+
+        Job jobs[] { { 1, 0, "D" }, { 2, 1, "M" }, { 3, 0, "E" },
+                     { 4, 0, "T" }, { 5, 2, "Q" }, { 6, 1, "V" } };
+
+        // Each job counts the primes below `time_id * range_size`, by
+        // submitting a subjob per chunk of numbers. The subjobs are added to
+        // the deque of the worker running the job, and idle workers steal
+        // them.
+        auto num_primes = vector<atomic<unsigned int>>(size(jobs));
+        for (size_t i { 0 }; i < size(jobs); ++i) {
+            pool.submit([&pool, &count = num_primes[i], job = jobs[i]] {
+                auto const last = job.time_id * range_size;
+                for (unsigned int first { 0 }; first < last;
+                     first += chunk_size) {
+                    pool.submit([&count, first] {
+                        unsigned int n { 0 };
+                        for (auto k = first; k < first + chunk_size; ++k) {
+                            n += is_prime(k);
+                        }
+                        count.fetch_add(n);
+                    });
+                }
+            });
+        }
+        pool.wait();
+
+        for (size_t i { 0 }; i < size(jobs); ++i) {
+            cout << jobs[i] << ": " << num_primes[i] << " primes below "
+                 << jobs[i].time_id * range_size << endl;
+        }
+    }
+    catch (const std::exception& e) {
+        cerr << "Uncaught exception: " << e.what() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+
+// clang-format off
+
+/* === COMPILE & RUN ===
+clear && g++ demo_executor.cpp -o demo_executor -std=c++20 -g -Og -Wall -pedantic -march=native -fconcepts-diagnostics-depth=2 -I./queue -pthread && ./demo_executor
+
+clear && g++ demo_executor.cpp -o demo_executor -std=c++20 -O3 -march=native -DNDEBUG -I./queue -pthread && ./demo_executor
+*/
+
+/* === OUTPUT ===
+Running jobs on 4 workers...
+
+Job(name=D, time_id=1, priority=0): 1229 primes below 10000
+Job(name=M, time_id=2, priority=1): 2262 primes below 20000
+Job(name=E, time_id=3, priority=0): 3245 primes below 30000
+Job(name=T, time_id=4, priority=0): 4203 primes below 40000
+Job(name=Q, time_id=5, priority=2): 5133 primes below 50000
+Job(name=V, time_id=6, priority=1): 6057 primes below 60000
+*/
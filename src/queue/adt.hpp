@@ -43,8 +43,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef QUEUE_ADT_HPP
 #define QUEUE_ADT_HPP
 
+#include <concepts>      // same_as<T, U>
 #include <cstddef>       // size_t
 #include <functional>    // function<T>
+#include <iterator>      // input_iterator<I>, contiguous_iterator<I>, ...
+#include <span>          // span<T>
 #include <type_traits>   // remove_const_t<T>, enable_if<T>
 #include <exception>     // exception
 #include <string>        // string, string_view
@@ -70,6 +73,18 @@ concept Insertable = requires (T t, std::ostream& os) {
                     };
 // clang-format on
 
+/**
+ * @brief Specifies that the type `It` is a contiguous iterator to elements of
+ *      type `T`, so that the elements it refers to can be accessed through a
+ *      raw pointer `T*`.
+ *
+ * @tparam It The type to test.
+ * @tparam T The element type.
+ */
+template <typename It, typename T>
+concept ContiguousIteratorOf = std::contiguous_iterator<It> &&
+                               std::same_as<std::iter_value_t<It>, T>;
+
 /**
  * @brief Empty queue error.
  *
@@ -101,6 +116,37 @@ public:
         "invalid operation on an empty queue";
 };
 
+/**
+ * @brief Full queue error.
+ *
+ * An exception that indicates an operation on a bounded queue is invalid when
+ * the queue is full.
+ */
+class FullQueueError : public std::exception
+{
+    std::string msg_;
+
+public:
+    /**
+     * @brief Constructs a new Full Queue Error object.
+     *
+     * @param custom_message A custom message. Defaults to none.
+     * @note If no custom message is provided, the default error message will
+     *      be used.
+     */
+    FullQueueError(std::string custom_message = "")
+        : msg_ { custom_message } {}
+
+    /** Gets the error message. */
+    const char* what() const noexcept override {
+        return msg_.empty() ? default_msg : msg_.c_str();
+    }
+
+    /** Default error message */
+    static constexpr const char* default_msg =
+        "invalid operation on a full queue";
+};
+
 // -----------------------------------------------------------------------------
 
 /**
@@ -112,6 +158,10 @@ public:
  *
  * @tparam Elem The element type.
  * @tparam Impl The derived implementation class.
+ * @tparam Derived The exact type of the derived implementation class. Defaults
+ *      to `Impl<Elem>`; it only needs to be specified when `Impl` takes
+ *      additional template parameters beyond the element type and they are
+ *      not all defaulted.
  * @note All implementations of the queue ADT must statically inherit this
  *      class template using the Curiously Recurring Template Pattern (CRTP).
  *      The inherited class template must implement the private member
@@ -121,25 +171,33 @@ public:
  *      overloads, unless the client code of the inherited class template will
  *      not require certain operations. A default implementation for
  *      `to_string_()` is provided but you may override it to customize the
- *      string representation for your implementation.
+ *      string representation for your implementation. Likewise, default
+ *      implementations for the bulk operations `enqueue_range_()`,
+ *      `dequeue_n_()` and `splice_()` are provided in terms of `enqueue_()`,
+ *      `front_()` and `dequeue_()`; override them where the underlying
+ *      storage allows a faster bulk transfer. All member functions but
+ *      `iter()` and `to_string()` are `constexpr`, so that queues of
+ *      implementations with `constexpr` private member functions are usable
+ *      in constant expressions.
  */
-template <typename Elem, template <typename> typename Impl>
+template <typename Elem, template <typename> typename Impl,
+          typename Derived = Impl<Elem>>
 class IQueue
 {
     // Allow derived impl class to access private ctor
-    friend class Impl<Elem>;
+    friend Derived;
 
 public:
     /** Queue element type. */
     using elem_type = std::remove_const_t<Elem>;
 
-    ~IQueue();
+    constexpr ~IQueue();
 
     /** Number of elements in the queue. */
-    std::size_t size() const noexcept;
+    constexpr std::size_t size() const noexcept;
 
     /** Determines if this queue has no elements. */
-    bool empty() const noexcept;
+    constexpr bool empty() const noexcept;
 
     /**
      * @brief Iterates over all elements of this queue from the front.
@@ -172,7 +230,7 @@ public:
      * @returns The front element.
      * @throws dsa::EmptyQueueError if the queue is empty.
      */
-    Elem& front();
+    constexpr Elem& front();
 
     /**
      * @brief Accesses (read-only) the element at the front of this queue.
@@ -180,7 +238,7 @@ public:
      * @returns The front element (immutable).
      * @throws dsa::EmptyQueueError if the queue is empty.
      */
-    Elem const& front() const;
+    constexpr Elem const& front() const;
 
     /**
      * @brief Adds an element to the end of this queue.
@@ -190,7 +248,7 @@ public:
      *
      * @param elem The element to be added.
      */
-    void enqueue(Elem const& elem);
+    constexpr void enqueue(Elem const& elem);
 
     /**
      * @brief Adds an element to the end of this queue.
@@ -199,14 +257,14 @@ public:
      *
      * @param elem The element to be added.
      */
-    void enqueue(Elem&& elem);
+    constexpr void enqueue(Elem&& elem);
 
     /**
      * @brief Removes the element at end of this queue.
      *
      * @throws dsa::EmptyQueueError if this queue is empty.
      */
-    void dequeue();
+    constexpr void dequeue();
 
     /**
      * @brief Creates a new element in-place after the last element of this
@@ -224,17 +282,81 @@ public:
      *      complete with respect to the Queue ADT in theory.
      */
     template <typename... Args>
-    void emplace(Args&&... args);
+    constexpr void emplace(Args&&... args);
+
+    /**
+     * @brief Adds all elements in a range to the end of this queue.
+     *
+     * Elements are added in the order they appear in the range `[first,
+     * last)`. Each element is copy- or move-constructed from the result of
+     * dereferencing the iterator.
+     *
+     * @tparam InputIt Type of the iterator to the range.
+     * @tparam Sentinel Type of the sentinel marking the end of the range.
+     * @param first Iterator to the first element of the range.
+     * @param last Sentinel marking the end of the range.
+     */
+    template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+    constexpr void enqueue_range(InputIt first, Sentinel last);
+
+    /**
+     * @brief Adds all elements of a contiguous sequence to the end of this
+     * queue.
+     *
+     * A deep copy of each element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elems The elements to be added, in order.
+     */
+    constexpr void enqueue_span(std::span<Elem const> elems);
+
+    /**
+     * @brief Removes the first `n` elements of this queue and writes them out.
+     *
+     * Elements are moved to the output range in the queue order before they
+     * are removed.
+     *
+     * @tparam OutputIt Type of the iterator to the output range.
+     * @param n Number of elements to remove.
+     * @param out Iterator to the beginning of the output range.
+     * @return Iterator past the last element written.
+     * @throws dsa::EmptyQueueError if this queue has fewer than `n` elements,
+     *      in which case no element is removed.
+     */
+    template <std::output_iterator<Elem> OutputIt>
+    constexpr OutputIt dequeue_n(std::size_t n, OutputIt out);
+
+    /**
+     * @brief Moves all elements of another queue to the end of this queue,
+     * leaving the other queue empty.
+     *
+     * The elements keep their order, after the elements of this queue. It's a
+     * no-op if `other` is this queue.
+     *
+     * @param other The queue whose elements are to be moved.
+     */
+    constexpr void splice(Derived& other);
 
 private:
     // Prohibit direct instantiation of IQueue
-    IQueue();
-    Impl<Elem>*       derived_();
-    Impl<Elem> const* derived_() const;
+    constexpr IQueue();
+    constexpr Derived*       derived_();
+    constexpr Derived const* derived_() const;
 
     // Default impl of to_string_()
     template <Insertable T = Elem>
     std::string to_string_(std::string_view prefix, std::string_view sep) const;
+
+    // Default impl of enqueue_range_()
+    template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+    constexpr void enqueue_range_(InputIt first, Sentinel last);
+
+    // Default impl of dequeue_n_()
+    template <std::output_iterator<Elem> OutputIt>
+    constexpr OutputIt dequeue_n_(std::size_t n, OutputIt out);
+
+    // Default impl of splice_()
+    constexpr void splice_(Derived& other);
 };
 
 /**
@@ -242,25 +364,28 @@ private:
  *
  * @tparam Elem The element type.
  * @tparam Impl The derived implementation class.
+ * @tparam Derived The exact type of the derived implementation class.
  * @param queue Pointer to a queue on the free store.
  * @note **IMPORTANT** This is the only proper way to destroy a queue via a
  *      base pointer. DO NOT use `delete queue;` in such context, which will
  *      lead to memory leak.
  */
-template <typename Elem, template <typename> typename Impl>
-void destroy(IQueue<Elem, Impl>* queue);
+template <typename Elem, template <typename> typename Impl, typename Derived>
+void destroy(IQueue<Elem, Impl, Derived>* queue);
 
 /**
  * @brief Writes the string representation of this queue to an output stream.
  *
  * @tparam Elem Type of each element of the queue.
  * @tparam Impl The derived implementation class of the Queue ADT.
+ * @tparam Derived The exact type of the derived implementation class.
  * @param os The output stream to write to.
  * @param queue The queue of which the string representation is to output.
  * @return The outstream to write to.
  */
-template <Insertable Elem, template <typename> typename Impl>
-std::ostream& operator<<(std::ostream& os, IQueue<Elem, Impl> const* queue);
+template <Insertable Elem, template <typename> typename Impl, typename Derived>
+std::ostream& operator<<(std::ostream&                      os,
+                         IQueue<Elem, Impl, Derived> const* queue);
 
 }   // namespace dsa
 
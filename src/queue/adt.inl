@@ -40,85 +40,114 @@ namespace dsa
 
 // === PUBLIC METHODS ===
 
-template <typename Elem, template <typename> typename Impl>
-IQueue<Elem, Impl>::~IQueue() {
+template <typename Elem, template <typename> typename Impl, typename Derived>
+constexpr IQueue<Elem, Impl, Derived>::~IQueue() {
     /* Do nothing. */
 }
 
-template <typename Elem, template <typename> typename Impl>
-std::size_t IQueue<Elem, Impl>::size() const noexcept {
+template <typename Elem, template <typename> typename Impl, typename Derived>
+constexpr std::size_t IQueue<Elem, Impl, Derived>::size() const noexcept {
     return derived_()->size_();
 }
 
-template <typename Elem, template <typename> typename Impl>
-bool IQueue<Elem, Impl>::empty() const noexcept {
+template <typename Elem, template <typename> typename Impl, typename Derived>
+constexpr bool IQueue<Elem, Impl, Derived>::empty() const noexcept {
     return derived_()->empty_();
 }
 
-template <typename Elem, template <typename> typename Impl>
-void IQueue<Elem, Impl>::iter(std::function<void(Elem const&)> action) const {
+template <typename Elem, template <typename> typename Impl, typename Derived>
+void IQueue<Elem, Impl, Derived>::iter(
+    std::function<void(Elem const&)> action) const {
     derived_()->iter_(action);
 }
 
-template <typename Elem, template <typename> typename Impl>
+template <typename Elem, template <typename> typename Impl, typename Derived>
 template <Insertable T>
-std::string IQueue<Elem, Impl>::to_string(std::string_view prefix,
-                                          std::string_view sep) const {
+std::string
+    IQueue<Elem, Impl, Derived>::to_string(std::string_view prefix,
+                                           std::string_view sep) const {
     return derived_()->to_string_(prefix, sep);
 }
 
-template <typename Elem, template <typename> typename Impl>
-Elem& IQueue<Elem, Impl>::front() {
+template <typename Elem, template <typename> typename Impl, typename Derived>
+constexpr Elem& IQueue<Elem, Impl, Derived>::front() {
     return derived_()->front_();
 }
 
-template <typename Elem, template <typename> typename Impl>
-Elem const& IQueue<Elem, Impl>::front() const {
+template <typename Elem, template <typename> typename Impl, typename Derived>
+constexpr Elem const& IQueue<Elem, Impl, Derived>::front() const {
     return derived_()->front_();
 }
 
-template <typename Elem, template <typename> typename Impl>
-void IQueue<Elem, Impl>::enqueue(Elem const& elem) {
+template <typename Elem, template <typename> typename Impl, typename Derived>
+constexpr void IQueue<Elem, Impl, Derived>::enqueue(Elem const& elem) {
     derived_()->enqueue_(elem);
 }
 
-template <typename Elem, template <typename> typename Impl>
-void IQueue<Elem, Impl>::enqueue(Elem&& elem) {
+template <typename Elem, template <typename> typename Impl, typename Derived>
+constexpr void IQueue<Elem, Impl, Derived>::enqueue(Elem&& elem) {
     derived_()->enqueue_(std::move(elem));
 }
 
-template <typename Elem, template <typename> typename Impl>
-void IQueue<Elem, Impl>::dequeue() {
+template <typename Elem, template <typename> typename Impl, typename Derived>
+constexpr void IQueue<Elem, Impl, Derived>::dequeue() {
     derived_()->dequeue_();
 }
 
-template <typename Elem, template <typename> typename Impl>
+template <typename Elem, template <typename> typename Impl, typename Derived>
 template <typename... Args>
-void IQueue<Elem, Impl>::emplace(Args&&... args) {
+constexpr void IQueue<Elem, Impl, Derived>::emplace(Args&&... args) {
     derived_()->emplace_(std::forward<Args>(args)...);
 }
 
+template <typename Elem, template <typename> typename Impl, typename Derived>
+template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+constexpr void IQueue<Elem, Impl, Derived>::enqueue_range(InputIt  first,
+                                                          Sentinel last) {
+    derived_()->enqueue_range_(std::move(first), std::move(last));
+}
+
+template <typename Elem, template <typename> typename Impl, typename Derived>
+constexpr void
+    IQueue<Elem, Impl, Derived>::enqueue_span(std::span<Elem const> elems) {
+    derived_()->enqueue_range_(elems.begin(), elems.end());
+}
+
+template <typename Elem, template <typename> typename Impl, typename Derived>
+template <std::output_iterator<Elem> OutputIt>
+constexpr OutputIt IQueue<Elem, Impl, Derived>::dequeue_n(std::size_t n,
+                                                          OutputIt    out) {
+    return derived_()->dequeue_n_(n, std::move(out));
+}
+
+template <typename Elem, template <typename> typename Impl, typename Derived>
+constexpr void IQueue<Elem, Impl, Derived>::splice(Derived& other) {
+    if (&other == derived_()) return;
+    derived_()->splice_(other);
+}
+
 // === PRIVATE METHODS ===
 
-template <typename Elem, template <typename> typename Impl>
-IQueue<Elem, Impl>::IQueue() {
+template <typename Elem, template <typename> typename Impl, typename Derived>
+constexpr IQueue<Elem, Impl, Derived>::IQueue() {
     /* Do nothing. */
 }
 
-template <typename Elem, template <typename> typename Impl>
-Impl<Elem>* IQueue<Elem, Impl>::derived_() {
-    return static_cast<Impl<Elem>*>(this);
+template <typename Elem, template <typename> typename Impl, typename Derived>
+constexpr Derived* IQueue<Elem, Impl, Derived>::derived_() {
+    return static_cast<Derived*>(this);
 }
 
-template <typename Elem, template <typename> typename Impl>
-const Impl<Elem>* IQueue<Elem, Impl>::derived_() const {
-    return static_cast<Impl<Elem> const*>(this);
+template <typename Elem, template <typename> typename Impl, typename Derived>
+constexpr Derived const* IQueue<Elem, Impl, Derived>::derived_() const {
+    return static_cast<Derived const*>(this);
 }
 
-template <typename Elem, template <typename> typename Impl>
+template <typename Elem, template <typename> typename Impl, typename Derived>
 template <Insertable T>
-std::string IQueue<Elem, Impl>::to_string_(std::string_view prefix,
-                                           std::string_view sep) const {
+std::string
+    IQueue<Elem, Impl, Derived>::to_string_(std::string_view prefix,
+                                            std::string_view sep) const {
     std::stringstream ss {};
     std::size_t       n { this->size() };
     if (!prefix.empty()) ss << prefix;
@@ -131,15 +160,47 @@ std::string IQueue<Elem, Impl>::to_string_(std::string_view prefix,
     return ss.str();
 }
 
+template <typename Elem, template <typename> typename Impl, typename Derived>
+template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+constexpr void IQueue<Elem, Impl, Derived>::enqueue_range_(InputIt  first,
+                                                           Sentinel last) {
+    for (; first != last; ++first) derived_()->enqueue_(*first);
+}
+
+template <typename Elem, template <typename> typename Impl, typename Derived>
+template <std::output_iterator<Elem> OutputIt>
+constexpr OutputIt IQueue<Elem, Impl, Derived>::dequeue_n_(std::size_t n,
+                                                           OutputIt    out) {
+    if (n > this->size()) {
+        throw EmptyQueueError { "dequeue more elements than the queue has" };
+    }
+    for (; n > 0; --n) {
+        *out++ = std::move(derived_()->front_());
+        derived_()->dequeue_();
+    }
+    return out;
+}
+
+template <typename Elem, template <typename> typename Impl, typename Derived>
+constexpr void IQueue<Elem, Impl, Derived>::splice_(Derived& other) {
+    // Each element is removed only once it has been added, so that none is
+    // lost should adding one throw
+    while (!other.empty_()) {
+        derived_()->enqueue_(std::move(other.front_()));
+        other.dequeue_();
+    }
+}
+
 // === FREE FUNCTIONS ====
 
-template <typename Elem, template <typename> typename Impl>
-void destroy(IQueue<Elem, Impl>* queue) {
-    if (queue) delete static_cast<Impl<Elem>*>(queue);
+template <typename Elem, template <typename> typename Impl, typename Derived>
+void destroy(IQueue<Elem, Impl, Derived>* queue) {
+    if (queue) delete static_cast<Derived*>(queue);
 }
 
-template <Insertable Elem, template <typename> typename Impl>
-std::ostream& operator<<(std::ostream& os, IQueue<Elem, Impl> const* queue) {
+template <Insertable Elem, template <typename> typename Impl, typename Derived>
+std::ostream& operator<<(std::ostream&                      os,
+                         IQueue<Elem, Impl, Derived> const* queue) {
     return os << queue->to_string();
 }
 
@@ -62,6 +62,22 @@ concept BinaryPredicate = requires (T t, Arg a, Arg b) {
                               { t(a, b) } -> std::same_as<bool>;
                           };
 
+/**
+ * @brief Specifies that the queue type `Q` allocates memory with an allocator
+ *       of type `Q::allocator_type`, e.g. `dsa::CircArrayQueue`, which it can
+ *       be created empty or copy-constructed with.
+ *
+ * @tparam Q The type to test.
+ */
+template <typename Q>
+concept AllocatorAwareQueue =
+    requires (Q const& queue) {
+        typename Q::allocator_type;
+        { queue.get_allocator() } -> std::same_as<typename Q::allocator_type>;
+    } &&
+    std::constructible_from<Q, typename Q::allocator_type const&> &&
+    std::constructible_from<Q, Q const&, typename Q::allocator_type const&>;
+
 /**
  * @brief Stable-merges two queues.
  *
@@ -79,6 +95,8 @@ concept BinaryPredicate = requires (T t, Arg a, Arg b) {
  *       the original queues. The signature of an equivalent function reads
  *       `bool (Elem const&, Elem const&)`, i.e. it must satisfy the
  *       `dsa::BinaryPredicate` concept.
+ * @tparam Derived The exact type of the derived implementation class. Deduced
+ *       from the arguments.
  * @param queue1 A queue to merge. Mutable.
  * @param queue2 Another queue to merge. Mutable.
  * @return The merged queue if both queues to merge are not empty, one of the
@@ -87,11 +105,14 @@ concept BinaryPredicate = requires (T t, Arg a, Arg b) {
  *       done with the merged queue to free the memory allocated to it.
  * @note The complexity of the merge algorithm is `O(n1 + n2)` in both time and
  *      space, where `n1` and `n2` are the sizes of the two queues to merge.
+ *      If `Derived` satisfies `dsa::AllocatorAwareQueue`, the merged queue
+ *      allocates memory with the allocator of `queue1`. The elements left in
+ *      one queue once the other is exhausted are moved with `splice()`.
  */
 template <typename Elem, template <typename> typename Impl,
-          BinaryPredicate<Elem> compare>
-IQueue<Elem, Impl>* merge(IQueue<Elem, Impl>* queue1,
-                          IQueue<Elem, Impl>* queue2);
+          BinaryPredicate<Elem> compare, typename Derived = Impl<Elem>>
+IQueue<Elem, Impl, Derived>* merge(IQueue<Elem, Impl, Derived>* queue1,
+                                   IQueue<Elem, Impl, Derived>* queue2);
 
 /**
  * @overload
@@ -107,6 +128,8 @@ IQueue<Elem, Impl>* merge(IQueue<Elem, Impl>* queue1,
  *       the original queues. The signature of an equivalent function reads
  *       `bool (Elem const&, Elem const&)`, i.e. it must satisfy the
  *       `dsa::BinaryPredicate` concept.
+ * @tparam Derived The exact type of the derived implementation class. Deduced
+ *       from the arguments.
  * @param queue1 A queue to merge. Immutable; no change after merging.
  * @param queue2 Another queue to merge. Immutable; no change after merging.
  * @return The merged queue if both queues to merge are not empty, one of the
@@ -115,11 +138,14 @@ IQueue<Elem, Impl>* merge(IQueue<Elem, Impl>* queue1,
  *       done with the merged queue to free the memory allocated to it.
  * @note The complexity of the merge algorithm is `O(n1 + n2)` in both time and
  *      space, where `n1` and `n2` are the sizes of the two queues to merge.
+ *      If `Derived` satisfies `dsa::AllocatorAwareQueue`, the merged queue,
+ *      and the copies of the queues to merge that it is merged from, allocate
+ *      memory with the allocator of `queue1`.
  */
 template <typename Elem, template <typename> typename Impl,
-          BinaryPredicate<Elem> compare>
-IQueue<Elem, Impl>* merge(IQueue<Elem, Impl> const* queue1,
-                          IQueue<Elem, Impl> const* queue2);
+          BinaryPredicate<Elem> compare, typename Derived = Impl<Elem>>
+IQueue<Elem, Impl, Derived>* merge(IQueue<Elem, Impl, Derived> const* queue1,
+                                   IQueue<Elem, Impl, Derived> const* queue2);
 
 }   // namespace dsa
 
@@ -36,53 +36,78 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace dsa
 {
 
-template <typename Elem, template <typename> typename Impl,
-          BinaryPredicate<Elem> compare>
-IQueue<Elem, Impl>* merge(IQueue<Elem, Impl>* queue1,
-                          IQueue<Elem, Impl>* queue2) {
-
-    if (!queue1 || !queue2) return nullptr;
-    if (queue1->empty()) return queue2;
-    if (queue2->empty()) return queue1;
+namespace detail
+{
 
-    IQueue<Elem, Impl>* merged { new Impl<Elem> {} };
+// Merges two queues, neither of which is empty, into a new queue, which is
+// returned, draining both queues.
+template <typename Elem, template <typename> typename Impl,
+          BinaryPredicate<Elem> compare, typename Derived>
+IQueue<Elem, Impl, Derived>* merge_new(Derived& queue1, Derived& queue2) {
+    IQueue<Elem, Impl, Derived>* merged { nullptr };
+    if constexpr (AllocatorAwareQueue<Derived>) {
+        merged = new Derived(queue1.get_allocator());
+    } else {
+        merged = new Derived {};
+    }
 
     // Compare the elements at the front of two queues
-    while (!queue1->empty() && !queue2->empty()) {
-        if (compare()(queue1->front(), queue2->front())) {
-            merged->enqueue(queue1->front());
-            queue1->dequeue();
+    while (!queue1.empty() && !queue2.empty()) {
+        if (compare()(queue1.front(), queue2.front())) {
+            merged->enqueue(queue1.front());
+            queue1.dequeue();
         } else {
-            merged->enqueue(queue2->front());
-            queue2->dequeue();
+            merged->enqueue(queue2.front());
+            queue2.dequeue();
         }
     }
 
     // Handle unprocessed tail
-    auto* q = queue1->empty() ? queue2 : queue1;
-    while (!q->empty()) {
-        merged->enqueue(q->front());
-        q->dequeue();
-    }
+    merged->splice(queue1.empty() ? queue2 : queue1);
 
     return merged;
 }
 
+}   // namespace detail
+
 template <typename Elem, template <typename> typename Impl,
-          BinaryPredicate<Elem> compare>
-IQueue<Elem, Impl>* merge(IQueue<Elem, Impl> const* queue1,
-                          IQueue<Elem, Impl> const* queue2) {
+          BinaryPredicate<Elem> compare, typename Derived>
+IQueue<Elem, Impl, Derived>* merge(IQueue<Elem, Impl, Derived>* queue1,
+                                   IQueue<Elem, Impl, Derived>* queue2) {
 
     if (!queue1 || !queue2) return nullptr;
-    if (queue1->empty()) return const_cast<IQueue<Elem, Impl>*>(queue2);
-    if (queue2->empty()) return const_cast<IQueue<Elem, Impl>*>(queue1);
+    if (queue1->empty()) return queue2;
+    if (queue2->empty()) return queue1;
 
-    IQueue<Elem, Impl>* clone1 { new Impl<Elem> {
-        *static_cast<Impl<Elem> const*>(queue1) } };
-    IQueue<Elem, Impl>* clone2 { new Impl<Elem> {
-        *static_cast<Impl<Elem> const*>(queue2) } };
+    return detail::merge_new<Elem, Impl, compare, Derived>(
+        *static_cast<Derived*>(queue1), *static_cast<Derived*>(queue2));
+}
+
+template <typename Elem, template <typename> typename Impl,
+          BinaryPredicate<Elem> compare, typename Derived>
+IQueue<Elem, Impl, Derived>* merge(IQueue<Elem, Impl, Derived> const* queue1,
+                                   IQueue<Elem, Impl, Derived> const* queue2) {
+
+    if (!queue1 || !queue2) return nullptr;
+    if (queue1->empty())
+        return const_cast<IQueue<Elem, Impl, Derived>*>(queue2);
+    if (queue2->empty())
+        return const_cast<IQueue<Elem, Impl, Derived>*>(queue1);
+
+    // Copies to merge from, which are drained by merging, and destroyed
+    // afterwards
+    auto const& derived1 = *static_cast<Derived const*>(queue1);
+    auto        clone    = [&derived1](Derived const& queue) -> Derived {
+        if constexpr (AllocatorAwareQueue<Derived>) {
+            return Derived(queue, derived1.get_allocator());
+        } else {
+            return Derived(queue);
+        }
+    };
+    auto clone1 = clone(derived1);
+    auto clone2 = clone(*static_cast<Derived const*>(queue2));
 
-    return merge<Elem, Impl, compare>(clone1, clone2);
+    return detail::merge_new<Elem, Impl, compare, Derived>(clone1, clone2);
 }
 
 }   // namespace dsa
\ No newline at end of file
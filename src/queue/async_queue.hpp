@@ -0,0 +1,249 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      async_queue.hpp
+ * @brief     Async Queue
+ * @details   Generic queue whose consumers are coroutines that suspend while
+ *            it is empty -- an implementation of the Queue ADT using a
+ *            circular array queue.
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef ASYNC_QUEUE_HPP
+#define ASYNC_QUEUE_HPP
+
+#include <coroutine>   // coroutine_handle<Promise>
+#include <cstddef>     // size_t
+#include <optional>    // optional<T>
+
+#include "adt.hpp"                // IQueue<Elem, Impl>
+#include "circ_array_queue.hpp"   // CircArrayQueue<Elem>
+
+namespace dsa
+{
+
+/**
+ * @brief Coroutine-aware queue.
+ *
+ * An unbounded, generic queue type that implements the Queue ADT
+ * `dsa::IQueue` using a `dsa::CircArrayQueue`, and lets a coroutine wait for
+ * an element with `co_await q.pop()` instead of blocking its thread or polling
+ * the queue. This class template statically inherits the Queue ADT template
+ * class using the Curiously Recurring Template Pattern (CRTP).
+ *
+ * A coroutine that pops from an empty queue is suspended, and its awaiter,
+ * which lives in the coroutine frame, is linked to the end of a list of
+ * waiting consumers; no memory is allocated per wait. An element added while
+ * a consumer is waiting is handed over to the consumer at the front of the
+ * list, which is then resumed, in the thread that adds the element, before
+ * `enqueue()` or `emplace()` returns. Waiting consumers thus receive elements
+ * in the order they started waiting, and the queue is empty while any
+ * consumer waits.
+ *
+ * @tparam Elem The queue element type.
+ * @note The queue is not thread-safe: it is meant to be shared by coroutines
+ *      run by a single-threaded event loop, or by a strand. A coroutine
+ *      suspended on the queue must be resumed by an element or destroyed
+ *      before the queue is.
+ */
+template <typename Elem>
+class AsyncQueue : public IQueue<Elem, AsyncQueue>
+{
+    // Parent class, which is allowed to access the private impl methods
+    friend class IQueue<Elem, AsyncQueue>;
+
+public:
+    /**
+     * @brief Awaitable returned by `dsa::AsyncQueue::pop()`.
+     *
+     * Awaiting it removes the element at the front of the queue, suspending
+     * the awaiting coroutine while the queue is empty, and yields the element.
+     */
+    class PopAwaiter
+    {
+        friend class AsyncQueue;
+
+    public:
+        // The awaiter is linked into the queue while suspended, so it is
+        // neither copyable nor movable
+        PopAwaiter(PopAwaiter const&)            = delete;
+        PopAwaiter& operator=(PopAwaiter const&) = delete;
+
+        /** Unlinks the awaiter if its coroutine is destroyed while waiting. */
+        ~PopAwaiter();
+
+        /** Determines if an element can be popped without suspending. */
+        bool await_ready() const noexcept;
+
+        /** Links the awaiter to the end of the list of waiting consumers. */
+        void await_suspend(std::coroutine_handle<> consumer) noexcept;
+
+        /**
+         * @brief Removes the element at the front of the queue, or takes the
+         * element handed over on resumption.
+         *
+         * @return The element.
+         */
+        Elem await_resume();
+
+    private:
+        AsyncQueue*             q_;
+        std::coroutine_handle<> consumer_ {};
+        PopAwaiter*             prev_ { nullptr };
+        PopAwaiter*             next_ { nullptr };
+        std::optional<Elem>     elem_ {};
+        bool                    waiting_ { false };
+
+        explicit PopAwaiter(AsyncQueue& q) noexcept;
+    };
+
+    /**
+     * @brief Creates an empty queue.
+     *
+     * @param init_cap The initially anticipated maximum number of elements to
+     *      be stored in the queue.
+     */
+    AsyncQueue(std::size_t init_cap = 4096);
+
+    // Waiting consumers refer to the queue, so a queue is neither copyable
+    // nor movable
+    AsyncQueue(AsyncQueue const&)            = delete;
+    AsyncQueue& operator=(AsyncQueue const&) = delete;
+
+    /**
+     * @brief Removes the element at the front of this queue, once there is
+     * one.
+     *
+     * The result must be awaited in a coroutine: `co_await q.pop()` yields the
+     * element, suspending the coroutine while the queue is empty.
+     *
+     * @return The awaitable.
+     */
+    [[nodiscard]] PopAwaiter pop() noexcept;
+
+    /** Number of coroutines waiting for an element. */
+    std::size_t num_waiters() const noexcept;
+
+private:
+    CircArrayQueue<Elem> elems_;
+
+    // List of waiting consumers, the first to be resumed at the front
+    PopAwaiter* first_waiter_ { nullptr };
+    PopAwaiter* last_waiter_ { nullptr };
+    std::size_t num_waiters_ { 0 };
+
+    // Links an awaiter to the end of the list of waiting consumers.
+    void link_(PopAwaiter& awaiter) noexcept;
+    // Unlinks an awaiter from the list of waiting consumers.
+    void unlink_(PopAwaiter& awaiter) noexcept;
+
+    /** Number of elements in the queue. */
+    std::size_t size_() const noexcept;
+
+    /** Determines if this queue has no elements. */
+    bool empty_() const noexcept;
+
+    /**
+     * @brief Iterates over all elements of this queue from the front.
+     *
+     * The given operation will be performed on each element iterated.
+     *
+     * @param action The operation to be performed on each element.
+     */
+    void iter_(std::function<void(Elem const&)> action) const;
+
+    /**
+     * @brief Accesses the element at the front of this queue.
+     *
+     * @returns The front element.
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem& front_();
+
+    /**
+     * @brief Accesses (read-only) the element at the front of this queue.
+     *
+     * @returns The front element (immutable).
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem const& front_() const;
+
+    /**
+     * @brief Adds an element to the end of this queue, or hands it over to the
+     * first waiting consumer and resumes it.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elem The element to be added.
+     */
+    void enqueue_(Elem const& elem);
+
+    /**
+     * @brief Adds an element to the end of this queue, or hands it over to the
+     * first waiting consumer and resumes it.
+     *
+     * The element will be put into the queue using move semantics.
+     *
+     * @param elem The element to be added.
+     */
+    void enqueue_(Elem&& elem);
+
+    /**
+     * @brief Removes the element at end of this queue.
+     *
+     * @throws dsa::EmptyQueueError if this queue is empty.
+     */
+    void dequeue_();
+
+    /**
+     * @brief Creates a new element in-place after the last element of this
+     * queue, or for the first waiting consumer and resumes it.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     */
+    template <typename... Args>
+    void emplace_(Args&&... args);
+};
+
+}   // namespace dsa
+
+#include "async_queue.inl"
+
+#endif /* ASYNC_QUEUE_HPP */
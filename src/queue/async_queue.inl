@@ -0,0 +1,180 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "async_queue.hpp"
+
+#include <utility>   // move(), forward()
+
+namespace dsa
+{
+
+// === POP AWAITER ===
+
+// clang-format off
+template <typename Elem>
+AsyncQueue<Elem>::PopAwaiter::PopAwaiter(AsyncQueue& q) noexcept
+    : q_ { &q } {}
+// clang-format on
+
+template <typename Elem>
+AsyncQueue<Elem>::PopAwaiter::~PopAwaiter() {
+    if (waiting_) q_->unlink_(*this);
+}
+
+template <typename Elem>
+bool AsyncQueue<Elem>::PopAwaiter::await_ready() const noexcept {
+    return !q_->elems_.empty();
+}
+
+template <typename Elem>
+void AsyncQueue<Elem>::PopAwaiter::await_suspend(
+    std::coroutine_handle<> consumer) noexcept {
+    consumer_ = consumer;
+    q_->link_(*this);
+}
+
+template <typename Elem>
+Elem AsyncQueue<Elem>::PopAwaiter::await_resume() {
+    if (elem_) return std::move(*elem_);
+    auto elem = Elem(std::move(q_->elems_.front()));
+    q_->elems_.dequeue();
+    return elem;
+}
+
+// === PUBLIC METHODS ===
+
+// clang-format off
+template <typename Elem>
+AsyncQueue<Elem>::AsyncQueue(std::size_t init_cap)
+    : elems_ { init_cap } {}
+// clang-format on
+
+template <typename Elem>
+typename AsyncQueue<Elem>::PopAwaiter AsyncQueue<Elem>::pop() noexcept {
+    return PopAwaiter { *this };
+}
+
+template <typename Elem>
+std::size_t AsyncQueue<Elem>::num_waiters() const noexcept {
+    return num_waiters_;
+}
+
+// === PRIVATE METHODS ===
+
+template <typename Elem>
+void AsyncQueue<Elem>::link_(PopAwaiter& awaiter) noexcept {
+    awaiter.prev_    = last_waiter_;
+    awaiter.next_    = nullptr;
+    awaiter.waiting_ = true;
+    if (last_waiter_) {
+        last_waiter_->next_ = &awaiter;
+    } else {
+        first_waiter_ = &awaiter;
+    }
+    last_waiter_ = &awaiter;
+    ++num_waiters_;
+}
+
+template <typename Elem>
+void AsyncQueue<Elem>::unlink_(PopAwaiter& awaiter) noexcept {
+    if (awaiter.prev_) {
+        awaiter.prev_->next_ = awaiter.next_;
+    } else {
+        first_waiter_ = awaiter.next_;
+    }
+    if (awaiter.next_) {
+        awaiter.next_->prev_ = awaiter.prev_;
+    } else {
+        last_waiter_ = awaiter.prev_;
+    }
+    awaiter.waiting_ = false;
+    --num_waiters_;
+}
+
+template <typename Elem>
+std::size_t AsyncQueue<Elem>::size_() const noexcept {
+    return elems_.size();
+}
+
+template <typename Elem>
+bool AsyncQueue<Elem>::empty_() const noexcept {
+    return elems_.empty();
+}
+
+template <typename Elem>
+void AsyncQueue<Elem>::iter_(std::function<void(Elem const&)> action) const {
+    elems_.iter(action);
+}
+
+template <typename Elem>
+Elem& AsyncQueue<Elem>::front_() {
+    return const_cast<Elem&>(
+        const_cast<const AsyncQueue<Elem>*>(this)->front_());
+}
+
+template <typename Elem>
+Elem const& AsyncQueue<Elem>::front_() const {
+    return elems_.front();
+}
+
+template <typename Elem>
+void AsyncQueue<Elem>::enqueue_(Elem const& elem) {
+    emplace_(elem);
+}
+
+template <typename Elem>
+void AsyncQueue<Elem>::enqueue_(Elem&& elem) {
+    emplace_(std::move(elem));
+}
+
+template <typename Elem>
+void AsyncQueue<Elem>::dequeue_() {
+    elems_.dequeue();
+}
+
+template <typename Elem>
+template <typename... Args>
+void AsyncQueue<Elem>::emplace_(Args&&... args) {
+    if (!first_waiter_) {
+        elems_.emplace(std::forward<Args>(args)...);
+        return;
+    }
+    // Handed over before the consumer is unlinked, so that the consumer keeps
+    // waiting if the element fails to be constructed
+    auto& awaiter = *first_waiter_;
+    awaiter.elem_.emplace(std::forward<Args>(args)...);
+    unlink_(awaiter);
+    awaiter.consumer_.resume();
+}
+
+}   // namespace dsa
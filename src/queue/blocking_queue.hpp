@@ -0,0 +1,315 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      blocking_queue.hpp
+ * @brief     Blocking Queue
+ * @details   Generic queue whose consumers, and producers if bounded, block
+ *            until they can proceed -- an implementation of the Queue ADT that
+ *            wraps a thread-safe implementation.
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef BLOCKING_QUEUE_HPP
+#define BLOCKING_QUEUE_HPP
+
+#include <atomic>     // atomic<T>
+#include <chrono>     // duration<Rep, Period>
+#include <concepts>   // same_as<T, U>, constructible_from<T, Args...>
+#include <cstddef>    // size_t
+#include <cstdint>    // uint32_t
+
+#include "adt.hpp"               // IQueue<Elem, Impl>
+#include "concurrency.hpp"       // cache_line_size, futex_wait(), ...
+#include "mpmc_ring_queue.hpp"   // MPMCRingQueue<Elem>
+
+namespace dsa
+{
+
+/**
+ * @brief Specifies that the type `Q` is a thread-safe queue of elements of
+ *      type `Elem` that can be wrapped by `dsa::BlockingQueue`, e.g.
+ *      `dsa::MPMCRingQueue<Elem>` and `dsa::SegmentedArrayQueue<Elem>`.
+ *
+ * The queue is bounded if it can also fail to add an element through
+ * `try_enqueue()`.
+ *
+ * @tparam Q The type to test.
+ * @tparam Elem The element type.
+ */
+template <typename Q, typename Elem>
+concept ConcurrentQueueOf = requires (Q q, Elem& out) {
+                                { q.try_dequeue(out) } -> std::same_as<bool>;
+                            };
+
+/**
+ * @brief Blocking queue.
+ *
+ * A generic queue type that implements the Queue ADT `dsa::IQueue` by
+ * wrapping a thread-safe implementation, and lets a consumer wait for an
+ * element to be added, or a producer wait for a slot to be freed if the
+ * wrapped queue is bounded, instead of polling. This class template
+ * statically inherits the Queue ADT template class using the Curiously
+ * Recurring Template Pattern (CRTP).
+ *
+ * Waiting threads are blocked on a futex (`dsa::futex_wait()`), and count
+ * themselves in before they block. A thread that adds or removes an element
+ * only enters the kernel to wake another thread if that count is nonzero, so
+ * that the uncontended path never makes a system call.
+ *
+ * Once the queue is closed, the waiting threads are woken up. Producers can
+ * no longer add elements through `push_wait()`, whereas consumers can keep
+ * removing elements until the queue is empty.
+ *
+ * @tparam Elem The queue element type.
+ * @tparam Queue The thread-safe queue to wrap. Defaults to
+ *      `dsa::MPMCRingQueue<Elem>`.
+ * @note The operations of the Queue ADT do not block, and are thread-safe to
+ *      the same extent as those of the wrapped queue; they notify waiting
+ *      threads like their blocking counterparts.
+ */
+template <typename Elem, ConcurrentQueueOf<Elem> Queue = MPMCRingQueue<Elem>>
+class BlockingQueue
+    : public IQueue<Elem, BlockingQueue, BlockingQueue<Elem, Queue>>
+{
+    // Parent class, which is allowed to access the private impl methods
+    friend class IQueue<Elem, BlockingQueue, BlockingQueue<Elem, Queue>>;
+
+public:
+    /**
+     * @brief Creates an empty queue.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the wrapped queue type `Queue`.
+     * @param args Arguments to be passed to the constructor of the wrapped
+     *      queue type `Queue`, e.g. its capacity.
+     */
+    template <typename... Args>
+        requires std::constructible_from<Queue, Args...>
+    explicit BlockingQueue(Args&&... args);
+
+    // The wrapped queue is shared between threads, so a queue is neither
+    // copyable nor movable
+    BlockingQueue(BlockingQueue const&)            = delete;
+    BlockingQueue& operator=(BlockingQueue const&) = delete;
+
+    /**
+     * @brief Adds an element to the end of this queue, waiting while it is
+     * full.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elem The element to be added.
+     * @return `true` if the element is added, `false` if this queue is
+     *      closed.
+     */
+    bool push_wait(Elem const& elem);
+
+    /**
+     * @brief Adds an element to the end of this queue, waiting while it is
+     * full.
+     *
+     * The element will be put into the queue using move semantics.
+     *
+     * @param elem The element to be added. Left intact if this queue is
+     *      closed.
+     * @return `true` if the element is added, `false` if this queue is
+     *      closed.
+     */
+    bool push_wait(Elem&& elem);
+
+    /**
+     * @brief Moves the element at the front of this queue out and removes it,
+     * waiting while this queue is empty.
+     *
+     * @param out The object to move-assign the front element to.
+     * @return `true` if an element is removed, `false` if this queue is closed
+     *      and empty.
+     */
+    bool pop_wait(Elem& out);
+
+    /**
+     * @brief Moves the element at the front of this queue out and removes it,
+     * waiting while this queue is empty, but no longer than a timeout.
+     *
+     * @tparam Rep Arithmetic type of the number of ticks of the timeout.
+     * @tparam Period Tick period of the timeout.
+     * @param out The object to move-assign the front element to.
+     * @param timeout The maximum duration to wait for. A timeout too long for
+     *      `std::chrono::steady_clock` to count, e.g. `duration::max()`, never
+     *      expires.
+     * @return `true` if an element is removed, `false` if the timeout expired,
+     *      or if this queue is closed and empty.
+     */
+    template <typename Rep, typename Period>
+    bool pop_for(Elem& out, std::chrono::duration<Rep, Period> timeout);
+
+    /**
+     * @brief Moves the element at the front of this queue out and removes it,
+     * unless this queue is empty.
+     *
+     * @param out The object to move-assign the front element to.
+     * @return `true` if an element is removed, `false` if this queue is empty.
+     */
+    bool try_dequeue(Elem& out);
+
+    /**
+     * @brief Closes this queue, and wakes up all threads waiting on it.
+     *
+     * Closing a queue more than once has no further effect.
+     */
+    void close() noexcept;
+
+    /** Determines if this queue has been closed. */
+    bool closed() const noexcept;
+
+private:
+    // Whether the wrapped queue can be full
+    static constexpr bool bounded_ =
+        requires (Queue q, Elem&& elem) {
+            { q.try_enqueue(std::move(elem)) } -> std::same_as<bool>;
+        };
+
+    Queue q_;
+
+    // Futex word that consumers wait on, which changes whenever an element is
+    // added to an empty queue being waited on; and the number of consumers
+    // waiting or about to wait on it
+    alignas(cache_line_size) std::atomic<std::uint32_t> pushes_ { 0 };
+    std::atomic<std::uint32_t> num_pop_waiters_ { 0 };
+
+    // Futex word that producers wait on, which changes whenever an element is
+    // removed from a full queue being waited on; and the number of producers
+    // waiting or about to wait on it
+    alignas(cache_line_size) std::atomic<std::uint32_t> pops_ { 0 };
+    std::atomic<std::uint32_t> num_push_waiters_ { 0 };
+
+    alignas(cache_line_size) std::atomic<bool> closed_ { false };
+
+    // Wakes a consumer, if any is waiting, after an element is added.
+    void notify_pushed_() noexcept;
+    // Wakes a producer, if any is waiting, after an element is removed.
+    void notify_popped_() noexcept;
+    // Adds an element, waiting while the queue is full, unless it is closed.
+    template <typename E>
+    bool push_(E&& elem);
+    // Removes an element, waiting while the queue is empty using `wait()`,
+    // which takes the futex word to wait on and its value, and returns
+    // false once the caller must stop waiting.
+    template <typename Wait>
+    bool pop_(Elem& out, Wait&& wait);
+
+    /** Number of elements in the queue. */
+    std::size_t size_() const noexcept;
+
+    /** Determines if this queue has no elements. */
+    bool empty_() const noexcept;
+
+    /**
+     * @brief Iterates over all elements of this queue from the front.
+     *
+     * The given operation will be performed on each element iterated.
+     *
+     * @param action The operation to be performed on each element.
+     */
+    void iter_(std::function<void(Elem const&)> action) const;
+
+    /**
+     * @brief Accesses the element at the front of this queue.
+     *
+     * @returns The front element.
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem& front_();
+
+    /**
+     * @brief Accesses (read-only) the element at the front of this queue.
+     *
+     * @returns The front element (immutable).
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem const& front_() const;
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elem The element to be added.
+     * @throws dsa::FullQueueError if the wrapped queue is bounded and full,
+     *      or any exception thrown by the wrapped queue.
+     */
+    void enqueue_(Elem const& elem);
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * The element will be put into the queue using move semantics.
+     *
+     * @param elem The element to be added.
+     * @throws dsa::FullQueueError if the wrapped queue is bounded and full,
+     *      or any exception thrown by the wrapped queue.
+     */
+    void enqueue_(Elem&& elem);
+
+    /**
+     * @brief Removes the element at end of this queue.
+     *
+     * @throws dsa::EmptyQueueError if this queue is empty.
+     */
+    void dequeue_();
+
+    /**
+     * @brief Creates a new element in-place after the last element of this
+     * queue.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     * @throws dsa::FullQueueError if the wrapped queue is bounded and full,
+     *      or any exception thrown by the wrapped queue.
+     */
+    template <typename... Args>
+    void emplace_(Args&&... args);
+};
+
+}   // namespace dsa
+
+#include "blocking_queue.inl"
+
+#endif /* BLOCKING_QUEUE_HPP */
@@ -0,0 +1,247 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "blocking_queue.hpp"
+
+#include <climits>   // INT_MAX
+#include <utility>   // move(), forward()
+
+namespace dsa
+{
+
+// === PUBLIC METHODS ===
+
+// clang-format off
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+template <typename... Args>
+    requires std::constructible_from<Queue, Args...>
+BlockingQueue<Elem, Queue>::BlockingQueue(Args&&... args)
+    : q_(std::forward<Args>(args)...) {}
+// clang-format on
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+bool BlockingQueue<Elem, Queue>::push_wait(Elem const& elem) {
+    return push_(elem);
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+bool BlockingQueue<Elem, Queue>::push_wait(Elem&& elem) {
+    return push_(std::move(elem));
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+bool BlockingQueue<Elem, Queue>::pop_wait(Elem& out) {
+    return pop_(out, [](auto& word, std::uint32_t old) {
+        futex_wait(word, old);
+        return true;
+    });
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+template <typename Rep, typename Period>
+bool BlockingQueue<Elem, Queue>::pop_for(
+    Elem& out, std::chrono::duration<Rep, Period> timeout) {
+    using clock   = std::chrono::steady_clock;
+    using seconds = std::chrono::duration<double>;
+
+    // Compare in floating point, which cannot overflow, and wait forever if
+    // the deadline would be within a second of what the clock can count
+    auto const now      = clock::now();
+    auto const max_wait =
+        clock::time_point::max() - now - std::chrono::seconds { 1 };
+    auto const deadline =
+        timeout <= timeout.zero() ? now
+        : seconds(timeout) < seconds(max_wait)
+            ? now + std::chrono::ceil<clock::duration>(timeout)
+            : clock::time_point::max();
+    return pop_(out, [deadline](auto& word, std::uint32_t old) {
+        auto const remaining = deadline - clock::now();
+        if (remaining <= remaining.zero()) return false;
+        futex_wait_for(word, old, remaining);
+        return true;
+    });
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+bool BlockingQueue<Elem, Queue>::try_dequeue(Elem& out) {
+    if (!q_.try_dequeue(out)) return false;
+    notify_popped_();
+    return true;
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+void BlockingQueue<Elem, Queue>::close() noexcept {
+    if (closed_.exchange(true)) return;
+    // Every waiter is woken, whether or not it is counted in yet: one that is
+    // about to wait sees the futex word changed, and does not block
+    pushes_.fetch_add(1);
+    futex_wake(pushes_, INT_MAX);
+    pops_.fetch_add(1);
+    futex_wake(pops_, INT_MAX);
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+bool BlockingQueue<Elem, Queue>::closed() const noexcept {
+    return closed_.load(std::memory_order_acquire);
+}
+
+// === PRIVATE METHODS ===
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+void BlockingQueue<Elem, Queue>::notify_pushed_() noexcept {
+    // Pairs with the fence in pop_(): either a consumer about to wait is
+    // counted in here, or it sees the element on its last attempt
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (num_pop_waiters_.load(std::memory_order_relaxed) == 0) return;
+    pushes_.fetch_add(1, std::memory_order_release);
+    futex_wake(pushes_, 1);
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+void BlockingQueue<Elem, Queue>::notify_popped_() noexcept {
+    if constexpr (bounded_) {
+        // Pairs with the fence in push_()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (num_push_waiters_.load(std::memory_order_relaxed) == 0) return;
+        pops_.fetch_add(1, std::memory_order_release);
+        futex_wake(pops_, 1);
+    }
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+template <typename E>
+bool BlockingQueue<Elem, Queue>::push_(E&& elem) {
+    if constexpr (bounded_) {
+        // The element is left intact by every failed attempt, as it is only
+        // ever copied or moved into a claimed slot
+        while (!closed()) {
+            if (q_.try_enqueue(std::forward<E>(elem))) {
+                notify_pushed_();
+                return true;
+            }
+            auto const old = pops_.load(std::memory_order_acquire);
+            num_push_waiters_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            // Tried again once counted in, as a slot freed in between would
+            // not have woken this thread up
+            auto const pushed = q_.try_enqueue(std::forward<E>(elem));
+            if (!pushed && !closed()) futex_wait(pops_, old);
+            num_push_waiters_.fetch_sub(1, std::memory_order_relaxed);
+            if (pushed) {
+                notify_pushed_();
+                return true;
+            }
+        }
+        return false;
+    } else {
+        if (closed()) return false;
+        q_.enqueue(std::forward<E>(elem));
+        notify_pushed_();
+        return true;
+    }
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+template <typename Wait>
+bool BlockingQueue<Elem, Queue>::pop_(Elem& out, Wait&& wait) {
+    while (true) {
+        if (try_dequeue(out)) return true;
+        // Elements added before the queue was closed can still be removed
+        if (closed()) return try_dequeue(out);
+        auto const old = pushes_.load(std::memory_order_acquire);
+        num_pop_waiters_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        // Tried again once counted in, as an element added in between would
+        // not have woken this thread up
+        auto const popped   = try_dequeue(out);
+        auto       can_wait = true;
+        if (!popped && !closed()) can_wait = wait(pushes_, old);
+        num_pop_waiters_.fetch_sub(1, std::memory_order_relaxed);
+        if (popped) return true;
+        if (!can_wait) return try_dequeue(out);
+    }
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+std::size_t BlockingQueue<Elem, Queue>::size_() const noexcept {
+    return q_.size();
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+bool BlockingQueue<Elem, Queue>::empty_() const noexcept {
+    return q_.empty();
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+void BlockingQueue<Elem, Queue>::iter_(
+    std::function<void(Elem const&)> action) const {
+    q_.iter(action);
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+Elem& BlockingQueue<Elem, Queue>::front_() {
+    return const_cast<Elem&>(
+        const_cast<const BlockingQueue<Elem, Queue>*>(this)->front_());
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+Elem const& BlockingQueue<Elem, Queue>::front_() const {
+    return q_.front();
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+void BlockingQueue<Elem, Queue>::enqueue_(Elem const& elem) {
+    q_.enqueue(elem);
+    notify_pushed_();
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+void BlockingQueue<Elem, Queue>::enqueue_(Elem&& elem) {
+    q_.enqueue(std::move(elem));
+    notify_pushed_();
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+void BlockingQueue<Elem, Queue>::dequeue_() {
+    q_.dequeue();
+    notify_popped_();
+}
+
+template <typename Elem, ConcurrentQueueOf<Elem> Queue>
+template <typename... Args>
+void BlockingQueue<Elem, Queue>::emplace_(Args&&... args) {
+    q_.emplace(std::forward<Args>(args)...);
+    notify_pushed_();
+}
+
+}   // namespace dsa
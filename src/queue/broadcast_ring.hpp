@@ -0,0 +1,244 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      broadcast_ring.hpp
+ * @brief     Broadcast Ring
+ * @details   Bounded, lock-free ring buffer whose single producer thread
+ *            publishes every element to several consumer threads, which read
+ *            it in place, after the LMAX Disruptor.
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef BROADCAST_RING_HPP
+#define BROADCAST_RING_HPP
+
+#include <atomic>             // atomic<T>
+#include <cstddef>            // size_t
+#include <initializer_list>   // initializer_list<T>
+#include <memory>             // unique_ptr<T>
+#include <type_traits>        // is_nothrow_move_constructible_v<T>
+#include <vector>             // vector<T>
+
+#include "circ_array_queue.hpp"   // PowerOfTwoCapacity
+#include "concurrency.hpp"        // cache_line_size
+
+namespace dsa
+{
+
+/**
+ * @brief Single-producer broadcast ring.
+ *
+ * A bounded, generic ring buffer type through which one thread, the producer,
+ * publishes elements to any number of consumers, each run by a thread of its
+ * own, such that every consumer sees every element. An element is written
+ * once into the ring, and read in place by all consumers, instead of being
+ * copied into a queue per consumer.
+ *
+ * Each consumer has a cursor, i.e. the number of elements it has consumed,
+ * which only it advances. A consumer may depend on other consumers, in which
+ * case it only sees the elements that all of them have consumed, e.g. a
+ * persister that must run after a validator. The producer only reuses the
+ * slot of an element once the slowest cursor has passed it, so that no
+ * consumer misses an element or reads one being overwritten. The producer
+ * publishes its own cursor, and each consumer its cursor, with
+ * release-acquire ordering, on cache lines of their own.
+ *
+ * The consumers, and the dependencies between them, are set up before any
+ * element is published. A consumer processes all the elements available to it
+ * in one batch, through `consume()`, and advances its cursor once per batch.
+ *
+ * @tparam Elem The element type, which must be nothrow move constructible.
+ * @note An element stays in the ring, and is only destroyed when its slot is
+ *      reused or the ring is destroyed.
+ */
+template <typename Elem>
+class BroadcastRing
+{
+    static_assert(std::is_nothrow_move_constructible_v<Elem>,
+                  "element type must be nothrow move constructible");
+
+    struct Cursor;
+
+public:
+    /** Handle to a consumer of a ring, which identifies its cursor. */
+    class Consumer
+    {
+        friend class BroadcastRing;
+
+        Cursor* cursor_;
+
+        explicit Consumer(Cursor* cursor) noexcept : cursor_ { cursor } {}
+    };
+
+    /**
+     * @brief Creates an empty ring without consumers.
+     *
+     * @param capacity The maximum number of elements that can be published
+     *      before the slowest consumer, which is rounded up to the next power
+     *      of two (at least 1).
+     * @throws std::bad_alloc if memory cannot be allocated.
+     */
+    explicit BroadcastRing(std::size_t capacity = 4096);
+    ~BroadcastRing();
+
+    // The cursors are shared between threads, so a ring is neither copyable
+    // nor movable
+    BroadcastRing(BroadcastRing const&)            = delete;
+    BroadcastRing& operator=(BroadcastRing const&) = delete;
+
+    /**
+     * @brief Adds a consumer, which starts with the next element to be
+     * published.
+     *
+     * Must not be called once elements are being published or consumed.
+     *
+     * @param dependencies The consumers that must consume an element before
+     *      the new consumer can see it.
+     * @return The handle to the new consumer.
+     */
+    Consumer add_consumer(std::initializer_list<Consumer> dependencies = {});
+
+    /** Maximum number of elements ahead of the slowest consumer. */
+    std::size_t capacity() const noexcept;
+
+    /**
+     * @brief Publishes an element unless the slot it goes to is still to be
+     * consumed.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the ring. Must only be called by the producer thread.
+     *
+     * @param elem The element to be published.
+     * @return `true` if the element is published, `false` if the ring is
+     *      full.
+     * @throws Any exception thrown by the constructor of type `Elem`.
+     */
+    bool try_publish(Elem const& elem);
+
+    /**
+     * @brief Publishes an element unless the slot it goes to is still to be
+     * consumed.
+     *
+     * The element will be put into the ring using move semantics. Must only
+     * be called by the producer thread.
+     *
+     * @param elem The element to be published. Left intact if the ring is
+     *      full.
+     * @return `true` if the element is published, `false` if the ring is
+     *      full.
+     */
+    bool try_publish(Elem&& elem);
+
+    /**
+     * @brief Creates and publishes a new element in-place unless the slot it
+     * goes to is still to be consumed.
+     *
+     * Must only be called by the producer thread.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     * @return `true` if the element is published, `false` if the ring is
+     *      full.
+     * @throws Any exception thrown by the constructor of type `Elem`, in which
+     *      case nothing is published.
+     */
+    template <typename... Args>
+    bool try_emplace(Args&&... args);
+
+    /**
+     * @brief Number of elements published but yet to be consumed by a
+     * consumer, which it can see.
+     *
+     * Must only be called by the thread of the consumer.
+     *
+     * @param consumer The consumer.
+     * @return The number of elements.
+     */
+    std::size_t available(Consumer consumer) const noexcept;
+
+    /**
+     * @brief Consumes the elements available to a consumer, in the order
+     * they were published, in one batch.
+     *
+     * The given operation will be performed on each element, which is read in
+     * place. Must only be called by the thread of the consumer.
+     *
+     * @tparam F Type of the operation, which takes an `Elem const&`.
+     * @param consumer The consumer.
+     * @param action The operation to be performed on each element.
+     * @param max_elems The maximum number of elements to consume.
+     * @return The number of elements consumed.
+     * @throws Any exception thrown by `action`, in which case the elements
+     *      before the one it failed on are consumed.
+     */
+    template <typename F>
+    std::size_t consume(Consumer consumer, F&& action,
+                        std::size_t max_elems = static_cast<std::size_t>(-1));
+
+private:
+    // Number of elements consumed by a consumer, and the cursors of the
+    // consumers it depends on
+    struct alignas(cache_line_size) Cursor
+    {
+        std::atomic<std::size_t> pos { 0 };
+        std::vector<Cursor*>     dependencies {};
+    };
+
+    Elem*       elems_;
+    std::size_t capacity_;
+    // Consumers, in the order they were added
+    std::vector<std::unique_ptr<Cursor>> cursors_ {};
+
+    // Number of elements published (producer) and the slowest cursor as last
+    // seen by the producer
+    alignas(cache_line_size) std::atomic<std::size_t> published_ { 0 };
+    std::size_t cached_min_pos_ { 0 };
+
+    // Maps a position onto the array.
+    std::size_t wrap_(std::size_t pos) const noexcept;
+    // Gets the position of the slowest cursor.
+    std::size_t min_pos_() const noexcept;
+    // Gets the number of elements a cursor can see.
+    std::size_t limit_(Cursor const& cursor) const noexcept;
+};
+
+}   // namespace dsa
+
+#include "broadcast_ring.inl"
+
+#endif /* BROADCAST_RING_HPP */
@@ -0,0 +1,174 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "broadcast_ring.hpp"
+
+#include <algorithm>   // min()
+#include <utility>     // move(), forward()
+
+namespace dsa
+{
+
+// === PUBLIC METHODS ===
+
+// clang-format off
+template <typename Elem>
+BroadcastRing<Elem>::BroadcastRing(std::size_t capacity)
+    : capacity_ { PowerOfTwoCapacity::fit(capacity) } {
+    elems_ = std::allocator<Elem> {}.allocate(capacity_);
+}
+// clang-format on
+
+template <typename Elem>
+BroadcastRing<Elem>::~BroadcastRing() {
+    // Every slot holds an element once the ring has wrapped around
+    auto const published = published_.load(std::memory_order_relaxed);
+    auto const first     = published > capacity_ ? published - capacity_ : 0;
+    for (auto pos = first; pos != published; ++pos) {
+        std::destroy_at(elems_ + wrap_(pos));
+    }
+    std::allocator<Elem> {}.deallocate(elems_, capacity_);
+}
+
+template <typename Elem>
+typename BroadcastRing<Elem>::Consumer
+    BroadcastRing<Elem>::add_consumer(
+        std::initializer_list<Consumer> dependencies) {
+    auto cursor = std::make_unique<Cursor>();
+    cursor->pos.store(published_.load(std::memory_order_relaxed),
+                      std::memory_order_relaxed);
+    for (auto const dependency : dependencies) {
+        cursor->dependencies.push_back(dependency.cursor_);
+    }
+    cursors_.push_back(std::move(cursor));
+    return Consumer { cursors_.back().get() };
+}
+
+template <typename Elem>
+std::size_t BroadcastRing<Elem>::capacity() const noexcept {
+    return capacity_;
+}
+
+template <typename Elem>
+bool BroadcastRing<Elem>::try_publish(Elem const& elem) {
+    return try_emplace(elem);
+}
+
+template <typename Elem>
+bool BroadcastRing<Elem>::try_publish(Elem&& elem) {
+    return try_emplace(std::move(elem));
+}
+
+template <typename Elem>
+template <typename... Args>
+bool BroadcastRing<Elem>::try_emplace(Args&&... args) {
+    if constexpr (std::is_nothrow_constructible_v<Elem, Args...>) {
+        auto const pos = published_.load(std::memory_order_relaxed);
+        if (pos - cached_min_pos_ >= capacity_) {
+            // The cursors are only read once the ring looks full
+            cached_min_pos_ = min_pos_();
+            if (pos - cached_min_pos_ >= capacity_) return false;
+        }
+        auto* const slot = elems_ + wrap_(pos);
+        // The element of the previous lap has been consumed by all consumers
+        if (pos >= capacity_) std::destroy_at(slot);
+        std::construct_at(slot, std::forward<Args>(args)...);
+        // Release, so that consumers see the element fully constructed
+        published_.store(pos + 1, std::memory_order_release);
+        return true;
+    } else {
+        // Constructed before the slot is reused, so that a failure leaves the
+        // element of the previous lap in the slot
+        return try_emplace(Elem(std::forward<Args>(args)...));
+    }
+}
+
+template <typename Elem>
+std::size_t BroadcastRing<Elem>::available(Consumer consumer) const noexcept {
+    auto const& cursor = *consumer.cursor_;
+    return limit_(cursor) - cursor.pos.load(std::memory_order_relaxed);
+}
+
+template <typename Elem>
+template <typename F>
+std::size_t BroadcastRing<Elem>::consume(Consumer consumer, F&& action,
+                                         std::size_t max_elems) {
+    auto&      cursor = *consumer.cursor_;
+    auto const first  = cursor.pos.load(std::memory_order_relaxed);
+    auto const last   = first + std::min(limit_(cursor) - first, max_elems);
+    auto       pos    = first;
+    try {
+        for (; pos != last; ++pos) {
+            action(static_cast<Elem const&>(elems_[wrap_(pos)]));
+        }
+    }
+    catch (...) {
+        cursor.pos.store(pos, std::memory_order_release);
+        throw;
+    }
+    // Release, so that neither the producer nor dependent consumers get
+    // ahead of the reads of this consumer
+    cursor.pos.store(last, std::memory_order_release);
+    return last - first;
+}
+
+// === PRIVATE METHODS ===
+
+template <typename Elem>
+std::size_t BroadcastRing<Elem>::wrap_(std::size_t pos) const noexcept {
+    return PowerOfTwoCapacity::wrap(pos, capacity_);
+}
+
+template <typename Elem>
+std::size_t BroadcastRing<Elem>::min_pos_() const noexcept {
+    // Acquire, so that the slots are not reused before they are read
+    auto min_pos = published_.load(std::memory_order_relaxed);
+    for (auto const& cursor : cursors_) {
+        min_pos =
+            std::min(min_pos, cursor->pos.load(std::memory_order_acquire));
+    }
+    return min_pos;
+}
+
+template <typename Elem>
+std::size_t BroadcastRing<Elem>::limit_(Cursor const& cursor) const noexcept {
+    // Acquire, so that the elements are seen fully constructed
+    auto limit = published_.load(std::memory_order_acquire);
+    for (auto const* dependency : cursor.dependencies) {
+        limit = std::min(limit,
+                         dependency->pos.load(std::memory_order_acquire));
+    }
+    return limit;
+}
+
+}   // namespace dsa
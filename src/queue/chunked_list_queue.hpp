@@ -0,0 +1,307 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      chunked_list_queue.hpp
+ * @brief     Chunked List Queue
+ * @details   Unbounded generic queue -- an implementation of the Queue ADT
+ *            using a singly linked list of fixed-size array chunks.
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef CHUNKED_LIST_QUEUE_HPP
+#define CHUNKED_LIST_QUEUE_HPP
+
+#include <cstddef>           // size_t, byte
+#include <functional>        // function<T>
+#include <memory>            // allocator<T>, allocator_traits<Alloc>
+#include <memory_resource>   // pmr::polymorphic_allocator<T>
+#include <type_traits>       // is_same_v<T, U>
+
+#include "adt.hpp"   // IQueue<Elem, Impl>
+
+namespace dsa
+{
+
+/**
+ * @brief Chunked list queue.
+ *
+ * An unbounded, generic queue type that implements the Queue ADT
+ * `dsa::IQueue` using a singly linked list of chunks, i.e. an unrolled linked
+ * list, each chunk being an array of `ChunkSize` slots. This class template
+ * statically inherits the Queue ADT template class using the Curiously
+ * Recurring Template Pattern (CRTP). The instantiated class type is both
+ * copyable and movable.
+ *
+ * Elements are added to the last chunk and removed from the first. Once the
+ * last chunk is full, a new chunk is linked after it, so the queue grows
+ * without ever copying its elements, and allocates only once per `ChunkSize`
+ * elements. Once the first chunk is drained, it is unlinked and kept as a
+ * spare for the next chunk to be linked, so a queue whose number of elements
+ * stays about the same does not allocate at all. Iterating over the elements
+ * chases only one pointer per chunk. Each chunk keeps the bounds of the slots
+ * it holds elements in, so the chunks of two queues can be linked as they
+ * are, even if partially filled.
+ *
+ * @tparam Elem The queue element type.
+ * @tparam ChunkSize The number of slots per chunk. Defaults to 128.
+ * @tparam Alloc The allocator, rebound to allocate the chunks, which also
+ *      constructs and destroys the elements. Defaults to
+ *      `std::allocator<Elem>`. It is propagated on copy and move as
+ *      `std::allocator_traits<Alloc>` directs; see
+ *      `dsa::pmr::ChunkedListQueue` for a queue on a memory resource.
+ * @note The queue elements have value semantics. Each element is constructed
+ *      in its own slot, so `Elem` need not be default constructible.
+ */
+template <typename Elem, std::size_t ChunkSize = 128,
+          typename Alloc = std::allocator<Elem>>
+class ChunkedListQueue
+    : public IQueue<Elem, ChunkedListQueue,
+                    ChunkedListQueue<Elem, ChunkSize, Alloc>>
+{
+    static_assert(ChunkSize > 0, "chunk size must be positive");
+    static_assert(std::is_same_v<typename Alloc::value_type, Elem>,
+                  "allocator value type must be the element type");
+
+    // Parent class, which is allowed to access the private impl methods
+    friend class IQueue<Elem, ChunkedListQueue,
+                        ChunkedListQueue<Elem, ChunkSize, Alloc>>;
+
+    using AllocTraits = std::allocator_traits<Alloc>;
+
+    // Whether move assignment can always take over the chunks of the other
+    // queue, rather than moving its elements one by one
+    static constexpr bool moves_storage_ {
+        AllocTraits::propagate_on_container_move_assignment::value ||
+        AllocTraits::is_always_equal::value
+    };
+
+public:
+    /** Type of the allocator. */
+    using allocator_type = Alloc;
+
+    /** Creates an empty queue, without allocating memory. */
+    ChunkedListQueue() = default;
+    /** Creates an empty queue that allocates memory with `alloc`. */
+    explicit ChunkedListQueue(Alloc const& alloc);
+    ~ChunkedListQueue();
+
+    /**
+     * Copy-constructs a new queue from an existing queue, with the allocator
+     * that `std::allocator_traits<Alloc>` selects for a copy.
+     */
+    ChunkedListQueue(ChunkedListQueue const&);
+    /** Copy-constructs a new queue from an existing queue, with `alloc`. */
+    ChunkedListQueue(ChunkedListQueue const&, Alloc const& alloc);
+    /** Move-constructs a new queue from an existing queue. */
+    ChunkedListQueue(ChunkedListQueue&&) noexcept;
+    /**
+     * Move-constructs a new queue from an existing queue, with `alloc`, which
+     * moves the elements one by one unless `alloc` equals the allocator of the
+     * existing queue. The existing queue is left empty either way.
+     */
+    ChunkedListQueue(ChunkedListQueue&&, Alloc const& alloc);
+
+    /** Copy-assigns an existing queue to this queue. */
+    ChunkedListQueue& operator=(ChunkedListQueue const&);
+    /**
+     * Move-assigns an existing queue to this queue, which moves the elements
+     * one by one if the allocator is not propagated and the allocators of the
+     * two queues are not equal.
+     */
+    ChunkedListQueue& operator=(ChunkedListQueue&&) noexcept(moves_storage_);
+
+    /** Gets a copy of the allocator of this queue. */
+    Alloc get_allocator() const noexcept;
+
+private:
+    // Array chunk, whose slots hold elements from the begin index up to the
+    // end index, and which holds at least one element unless the queue is
+    // empty
+    struct Chunk
+    {
+        Chunk*                  next { nullptr };
+        std::size_t             begin { 0 };
+        std::size_t             end { 0 };
+        alignas(Elem) std::byte buf[sizeof(Elem) * ChunkSize];
+
+        Elem* elem(std::size_t idx) noexcept;
+    };
+
+    using ChunkAlloc  = typename AllocTraits::template rebind_alloc<Chunk>;
+    using ChunkTraits = typename AllocTraits::template rebind_traits<Chunk>;
+
+    [[no_unique_address]] Alloc alloc_ {};
+    // First chunk, or nullptr if no chunk has been allocated yet
+    Chunk*      head_ { nullptr };
+    // Last chunk, which is the first chunk if there is only one
+    Chunk*      tail_ { nullptr };
+    // Drained chunk kept for reuse
+    Chunk*      spare_ { nullptr };
+    std::size_t num_elems_ { 0 };
+
+    // Gets the spare chunk, or allocates one.
+    Chunk* take_chunk_();
+    // Keeps an unlinked chunk, which holds no elements, as the spare chunk,
+    // or frees it if there is one already.
+    void   recycle_(Chunk* chunk) noexcept;
+    // Destroys all elements and frees all chunks.
+    void   release_() noexcept;
+    // Takes over the chunks and the elements of `other`, leaving it empty,
+    // after this queue has been released.
+    void   steal_(ChunkedListQueue& other) noexcept;
+
+    /** Number of elements in the queue. */
+    std::size_t size_() const noexcept;
+
+    /** Determines if this queue has no elements. */
+    bool empty_() const noexcept;
+
+    /**
+     * @brief Iterates over all elements of this queue from the front.
+     *
+     * The given operation will be performed on each element iterated. It's a
+     * no-op if this queue is empty.
+     *
+     * @param action The operation to be performed on each element.
+     */
+    void iter_(std::function<void(Elem const&)> action) const;
+
+    /**
+     * @brief Accesses the element at the front of this queue.
+     *
+     * @returns The front element.
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem& front_();
+
+    /**
+     * @brief Accesses (read-only) the element at the front of this queue.
+     *
+     * @returns The front element (immutable).
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem const& front_() const;
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elem The element to be added.
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`.
+     */
+    void enqueue_(Elem const& elem);
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * The element will be put into the queue using move semantics.
+     *
+     * @param elem The element to be added.
+     * @throws std::bad_alloc or any exception thrown by the constuctor
+     * of type `Elem`.
+     */
+    void enqueue_(Elem&& elem);
+
+    /**
+     * @brief Removes the element at end of this queue.
+     *
+     * @throws dsa::EmptyQueueError if this queue is empty.
+     * @note The removed element is destroyed immediately.
+     */
+    void dequeue_();
+
+    /**
+     * @brief Creates a new element in-place after the last element of this
+     * queue.
+     *
+     * The new element is constructed in-place, directly in its array slot,
+     * using all of the arguments passed to this member function.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`, in which case this queue is unchanged.
+     */
+    template <typename... Args>
+    void emplace_(Args&&... args);
+
+    /**
+     * @brief Moves all elements of another queue to the end of this queue,
+     * leaving the other queue empty.
+     *
+     * If the allocators of the two queues are equal, the chunks of the other
+     * queue are linked after those of this one in constant time, without
+     * moving any element, however full the chunks are. The slots left free in
+     * the last chunk of this queue stay unused until the chunk is drained. If
+     * this queue is empty, the two queues swap their chunks instead, so that
+     * the other queue keeps a chunk to refill. Otherwise, the elements are
+     * moved one by one.
+     *
+     * @param other The queue whose elements are to be moved.
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`, in which case the elements not yet moved remain in the
+     *      other queue.
+     */
+    void splice_(ChunkedListQueue& other);
+};
+
+namespace pmr
+{
+
+/**
+ * @brief Chunked list queue that allocates memory from a
+ *      `std::pmr::memory_resource`, e.g. `std::pmr::monotonic_buffer_resource`.
+ *
+ * The memory resource is passed to the constructor, and is not propagated on
+ * copy or move assignment.
+ */
+template <typename Elem, std::size_t ChunkSize = 128>
+using ChunkedListQueue =
+    dsa::ChunkedListQueue<Elem, ChunkSize,
+                          std::pmr::polymorphic_allocator<Elem>>;
+
+}   // namespace pmr
+
+}   // namespace dsa
+
+#include "chunked_list_queue.inl"
+
+#endif /* CHUNKED_LIST_QUEUE_HPP */
@@ -0,0 +1,324 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "chunked_list_queue.hpp"
+
+#include <memory>        // construct_at()
+#include <new>           // launder()
+#include <type_traits>   // is_trivially_destructible_v<T>
+#include <utility>       // exchange(), forward(), move(), swap()
+
+namespace dsa
+{
+
+// === PUBLIC METHODS ===
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+ChunkedListQueue<Elem, ChunkSize, Alloc>::ChunkedListQueue(Alloc const& alloc)
+    : alloc_ { alloc } {}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+ChunkedListQueue<Elem, ChunkSize, Alloc>::~ChunkedListQueue() {
+    release_();
+}
+
+// clang-format off
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+ChunkedListQueue<Elem, ChunkSize, Alloc>::ChunkedListQueue(
+    ChunkedListQueue const& other)
+    : ChunkedListQueue { other,
+                         AllocTraits::select_on_container_copy_construction(
+                             other.alloc_) }
+{}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+ChunkedListQueue<Elem, ChunkSize, Alloc>::ChunkedListQueue(
+    ChunkedListQueue const& other, Alloc const& alloc)
+    : ChunkedListQueue { alloc }
+{
+    other.iter_([this](Elem const& elem) { emplace_(elem); });
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+ChunkedListQueue<Elem, ChunkSize, Alloc>::ChunkedListQueue(
+    ChunkedListQueue&& other) noexcept
+    : ChunkedListQueue { std::move(other.alloc_) }
+{
+    steal_(other);
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+ChunkedListQueue<Elem, ChunkSize, Alloc>::ChunkedListQueue(
+    ChunkedListQueue&& other, Alloc const& alloc)
+    : ChunkedListQueue { alloc }
+{
+    if (alloc_ == other.alloc_) {
+        steal_(other);
+        return;
+    }
+
+    // Chunks of the other allocator cannot be taken over, so the elements
+    // are moved one by one
+    for (auto* chunk = other.head_; chunk; chunk = chunk->next) {
+        for (auto idx = chunk->begin; idx < chunk->end; ++idx) {
+            emplace_(std::move_if_noexcept(*chunk->elem(idx)));
+        }
+    }
+    other.release_();
+}
+
+// clang-format on
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+ChunkedListQueue<Elem, ChunkSize, Alloc>&
+    ChunkedListQueue<Elem, ChunkSize, Alloc>::operator=(
+        ChunkedListQueue const& other) {
+    if (this == &other) return *this;
+
+    constexpr bool propagates {
+        AllocTraits::propagate_on_container_copy_assignment::value
+    };
+    auto copy = ChunkedListQueue { other, propagates ? other.alloc_ : alloc_ };
+    release_();
+    if constexpr (propagates) alloc_ = other.alloc_;
+    steal_(copy);
+
+    return *this;
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+ChunkedListQueue<Elem, ChunkSize, Alloc>&
+    ChunkedListQueue<Elem, ChunkSize, Alloc>::operator=(
+        ChunkedListQueue&& other) noexcept(moves_storage_) {
+    if (this == &other) return *this;
+
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+        release_();
+        alloc_ = std::move(other.alloc_);
+        steal_(other);
+    } else if (alloc_ == other.alloc_) {
+        release_();
+        steal_(other);
+    } else {
+        // Keep the allocator of this queue, which cannot free chunks of the
+        // other allocator, and move the elements one by one
+        auto moved = ChunkedListQueue { std::move(other), alloc_ };
+        release_();
+        steal_(moved);
+    }
+
+    return *this;
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+Alloc ChunkedListQueue<Elem, ChunkSize, Alloc>::get_allocator() const noexcept {
+    return alloc_;
+}
+
+// === PRIVATE METHODS ===
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+Elem* ChunkedListQueue<Elem, ChunkSize, Alloc>::Chunk::elem(
+    std::size_t idx) noexcept {
+    return std::launder(reinterpret_cast<Elem*>(buf) + idx);
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+typename ChunkedListQueue<Elem, ChunkSize, Alloc>::Chunk*
+    ChunkedListQueue<Elem, ChunkSize, Alloc>::take_chunk_() {
+    if (spare_) {
+        auto* const chunk = std::exchange(spare_, nullptr);
+        chunk->begin      = 0;
+        chunk->end        = 0;
+        return chunk;
+    }
+    auto chunk_alloc = ChunkAlloc { alloc_ };
+    return std::construct_at(ChunkTraits::allocate(chunk_alloc, 1));
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+void ChunkedListQueue<Elem, ChunkSize, Alloc>::recycle_(Chunk* chunk) noexcept {
+    if (spare_) {
+        auto chunk_alloc = ChunkAlloc { alloc_ };
+        ChunkTraits::deallocate(chunk_alloc, chunk, 1);
+    } else {
+        chunk->next = nullptr;
+        spare_      = chunk;
+    }
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+void ChunkedListQueue<Elem, ChunkSize, Alloc>::release_() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<Elem>) {
+        while (num_elems_ > 0) dequeue_();
+    }
+    // Chunks are trivially destructible
+    auto chunk_alloc = ChunkAlloc { alloc_ };
+    if (spare_) ChunkTraits::deallocate(chunk_alloc, spare_, 1);
+    while (head_) {
+        ChunkTraits::deallocate(chunk_alloc,
+                                std::exchange(head_, head_->next), 1);
+    }
+
+    tail_      = nullptr;
+    spare_     = nullptr;
+    num_elems_ = 0;
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+void ChunkedListQueue<Elem, ChunkSize, Alloc>::steal_(
+    ChunkedListQueue& other) noexcept {
+    head_      = std::exchange(other.head_, nullptr);
+    tail_      = std::exchange(other.tail_, nullptr);
+    spare_     = std::exchange(other.spare_, nullptr);
+    num_elems_ = std::exchange(other.num_elems_, 0);
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+std::size_t ChunkedListQueue<Elem, ChunkSize, Alloc>::size_() const noexcept {
+    return num_elems_;
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+bool ChunkedListQueue<Elem, ChunkSize, Alloc>::empty_() const noexcept {
+    return num_elems_ == 0;
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+void ChunkedListQueue<Elem, ChunkSize, Alloc>::iter_(
+    std::function<void(Elem const&)> action) const {
+    for (auto* chunk = head_; chunk; chunk = chunk->next) {
+        for (auto idx = chunk->begin; idx < chunk->end; ++idx) {
+            action(*chunk->elem(idx));
+        }
+    }
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+Elem& ChunkedListQueue<Elem, ChunkSize, Alloc>::front_() {
+    return const_cast<Elem&>(
+        const_cast<ChunkedListQueue<Elem, ChunkSize, Alloc> const*>(this)
+            ->front_());
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+Elem const& ChunkedListQueue<Elem, ChunkSize, Alloc>::front_() const {
+    if (num_elems_ == 0) throw EmptyQueueError {};
+    return *head_->elem(head_->begin);
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+void ChunkedListQueue<Elem, ChunkSize, Alloc>::enqueue_(Elem const& elem) {
+    emplace_(elem);
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+void ChunkedListQueue<Elem, ChunkSize, Alloc>::enqueue_(Elem&& elem) {
+    emplace_(std::move(elem));
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+void ChunkedListQueue<Elem, ChunkSize, Alloc>::dequeue_() {
+    if (num_elems_ == 0) throw EmptyQueueError { "dequeue from empty queue" };
+
+    AllocTraits::destroy(alloc_, head_->elem(head_->begin));
+    ++head_->begin;
+    if (--num_elems_ == 0) {
+        // The first chunk is the only one, so rewind it instead
+        head_->begin = 0;
+        head_->end   = 0;
+    } else if (head_->begin == head_->end) {
+        // Unlink the drained first chunk
+        recycle_(std::exchange(head_, head_->next));
+    }
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+template <typename... Args>
+void ChunkedListQueue<Elem, ChunkSize, Alloc>::emplace_(Args&&... args) {
+    if (tail_ && tail_->end < ChunkSize) {
+        AllocTraits::construct(alloc_, tail_->elem(tail_->end),
+                               std::forward<Args>(args)...);
+        ++tail_->end;
+        ++num_elems_;
+        return;
+    }
+
+    // The last chunk is full, or there is none, so the element goes first
+    // into a new chunk, which is linked only once the element is constructed
+    auto* chunk = take_chunk_();
+    try {
+        AllocTraits::construct(alloc_, chunk->elem(0),
+                               std::forward<Args>(args)...);
+    }
+    catch (...) {
+        recycle_(chunk);
+        throw;
+    }
+
+    if (tail_) tail_->next = chunk;
+    else head_ = chunk;
+    tail_      = chunk;
+    chunk->end = 1;
+    ++num_elems_;
+}
+
+template <typename Elem, std::size_t ChunkSize, typename Alloc>
+void ChunkedListQueue<Elem, ChunkSize, Alloc>::splice_(
+    ChunkedListQueue& other) {
+    if (other.num_elems_ == 0) return;
+
+    if (alloc_ == other.alloc_ && num_elems_ == 0) {
+        std::swap(head_, other.head_);
+        std::swap(tail_, other.tail_);
+        std::swap(spare_, other.spare_);
+        std::swap(num_elems_, other.num_elems_);
+        return;
+    }
+
+    if (alloc_ == other.alloc_) {
+        // Each chunk keeps its own bounds, so the lists are linked as they are
+        tail_->next = std::exchange(other.head_, nullptr);
+        tail_       = std::exchange(other.tail_, nullptr);
+        num_elems_ += std::exchange(other.num_elems_, 0);
+        return;
+    }
+
+    while (other.num_elems_ > 0) {
+        emplace_(std::move(other.front_()));
+        other.dequeue_();
+    }
+}
+
+}   // namespace dsa
@@ -44,9 +44,17 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef CIRC_ARRAY_QUEUE_HPP
 #define CIRC_ARRAY_QUEUE_HPP
 
-#include <cstddef>   // size_t
-#include <cstdint>   // uint8_t
-#include <memory>    // unique_ptr<T>
+#include <algorithm>         // max()
+#include <array>             // array<T, N>
+#include <bit>               // bit_ceil()
+#include <concepts>          // same_as<T, U>, convertible_to<From, To>
+#include <cstddef>           // size_t
+#include <cstdint>           // uint8_t
+#include <iterator>          // input_iterator<I>, output_iterator<I, T>
+#include <memory>            // allocator<T>, allocator_traits<Alloc>
+#include <memory_resource>   // pmr::polymorphic_allocator<T>
+#include <span>              // span<T>
+#include <type_traits>       // is_trivially_copyable_v<T>, is_same_v<T, U>
 
 #include "adt.hpp"   // IQueue<Elem, Impl>
 
@@ -54,6 +62,131 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace dsa
 {
 
+/**
+ * @brief Capacity mode of `dsa::CircArrayQueue` that keeps the capacity
+ *      exactly as requested.
+ *
+ * Array positions wrap around the end of the underlying array by a
+ * conditional subtraction, which requires no integer division.
+ */
+struct ExactCapacity
+{
+    /** Gets the capacity to allocate for a requested capacity `n`. */
+    static constexpr std::size_t fit(std::size_t n) noexcept { return n; }
+
+    /** Maps position `i < 2 * cap` onto the array of capacity `cap`. */
+    static constexpr std::size_t wrap(std::size_t i, std::size_t cap) noexcept {
+        return i >= cap ? i - cap : i;
+    }
+};
+
+/**
+ * @brief Capacity mode of `dsa::CircArrayQueue` that rounds the capacity up to
+ *      the next power of two.
+ *
+ * Array positions wrap around the end of the underlying array by masking off
+ * the high bits, at the expense of up to twice the requested memory.
+ */
+struct PowerOfTwoCapacity
+{
+    /** Gets the capacity to allocate for a requested capacity `n`. */
+    static constexpr std::size_t fit(std::size_t n) noexcept {
+        return std::bit_ceil(n);
+    }
+
+    /** Maps position `i` onto the array of capacity `cap`. */
+    static constexpr std::size_t wrap(std::size_t i, std::size_t cap) noexcept {
+        return i & (cap - 1);
+    }
+};
+
+/**
+ * @brief Specifies that the type `T` can serve as the capacity mode of a
+ *      `dsa::CircArrayQueue`, e.g. `dsa::ExactCapacity` and
+ *      `dsa::PowerOfTwoCapacity`.
+ *
+ * @tparam T The type to test.
+ */
+template <typename T>
+concept CapacityMode = requires (std::size_t n) {
+                           { T::fit(n) } -> std::same_as<std::size_t>;
+                           { T::wrap(n, n) } -> std::same_as<std::size_t>;
+                       };
+
+/**
+ * @brief Resizing policy of `dsa::CircArrayQueue` that grows and shrinks the
+ *      capacity geometrically.
+ *
+ * The capacity is multiplied by `GrowthFactor` when the queue is full, and is
+ * divided by it when fewer than one in `ShrinkDivisor` slots are occupied, but
+ * never below `MinCapacity`. As `ShrinkDivisor` must exceed `GrowthFactor`, a
+ * queue just resized is never at either threshold again, so a queue whose size
+ * oscillates around a threshold does not reallocate on every operation.
+ *
+ * @tparam GrowthFactor The factor by which the capacity is grown or shrunk.
+ *      Defaults to 2.
+ * @tparam ShrinkDivisor The capacity is shrunk when the number of elements
+ *      times this divisor is less than the capacity. Defaults to 4; take 0 to
+ *      never shrink.
+ * @tparam MinCapacity The minimum capacity. Defaults to 1.
+ */
+template <std::size_t GrowthFactor = 2, std::size_t ShrinkDivisor = 4,
+          std::size_t MinCapacity = 1>
+struct GeometricResizing
+{
+    static_assert(GrowthFactor >= 2, "growth factor must be at least 2");
+    static_assert(ShrinkDivisor == 0 || ShrinkDivisor > GrowthFactor,
+                  "shrink divisor must be 0 or greater than growth factor");
+
+    /** The capacity below which the queue never shrinks. */
+    static constexpr std::size_t min_capacity { MinCapacity };
+
+    /** Gets the capacity to grow to from a full queue of capacity `cap`. */
+    static constexpr std::size_t grow(std::size_t cap) noexcept {
+        return std::max({ cap * GrowthFactor, MinCapacity, std::size_t { 1 } });
+    }
+
+    /**
+     * Gets the capacity to shrink to for a queue of capacity `cap` holding
+     * `size` elements, which is `cap` if the queue is not to shrink.
+     */
+    static constexpr std::size_t shrink(std::size_t size,
+                                        std::size_t cap) noexcept {
+        if (ShrinkDivisor == 0 || size * ShrinkDivisor >= cap) return cap;
+        return std::max(cap / GrowthFactor, MinCapacity);
+    }
+};
+
+/**
+ * @brief Resizing policy of `dsa::CircArrayQueue` that grows the capacity
+ *      geometrically but never shrinks it.
+ *
+ * @tparam GrowthFactor The factor by which the capacity is grown. Defaults
+ *      to 2.
+ * @tparam MinCapacity The minimum capacity. Defaults to 1.
+ */
+template <std::size_t GrowthFactor = 2, std::size_t MinCapacity = 1>
+using NeverShrink = GeometricResizing<GrowthFactor, 0, MinCapacity>;
+
+/**
+ * @brief Specifies that the type `T` can serve as the resizing policy of a
+ *      `dsa::CircArrayQueue`, e.g. `dsa::GeometricResizing<>` and
+ *      `dsa::NeverShrink<>`.
+ *
+ * `T::grow(cap)` must return a capacity greater than `cap`, and
+ * `T::shrink(size, cap)` a capacity no less than `size` and no greater than
+ * `cap`, both before being fitted by the capacity mode.
+ *
+ * @tparam T The type to test.
+ */
+template <typename T>
+concept ResizePolicy =
+    std::convertible_to<decltype(T::min_capacity), std::size_t> &&
+    requires (std::size_t n) {
+        { T::grow(n) } -> std::same_as<std::size_t>;
+        { T::shrink(n, n) } -> std::same_as<std::size_t>;
+    };
+
 /**
  * @brief Circular array queue.
  *
@@ -63,35 +196,93 @@ namespace dsa
  * using the Curiously Recurring Template Pattern (CRTP).
  *
  * @tparam Elem The queue element type.
- * @note The queue elements have value semantics.
+ * @tparam Mode The capacity mode, which determines how the capacity is fitted
+ *      and how array positions wrap around. Defaults to `dsa::ExactCapacity`;
+ *      use `dsa::PowerOfTwoCapacity` for mask-based wrap-around.
+ * @tparam Policy The resizing policy, which determines when and by how much
+ *      the capacity is grown or shrunk. Defaults to `dsa::GeometricResizing<>`,
+ *      which doubles the capacity when full and halves it when a quarter full.
+ * @tparam Alloc The allocator of the underlying array, which also constructs
+ *      and destroys the elements. Defaults to `std::allocator<Elem>`. It is
+ *      propagated on copy and move as `std::allocator_traits<Alloc>` directs;
+ *      see `dsa::pmr::CircArrayQueue` for a queue on a memory resource.
+ * @note The queue elements have value semantics. Array slots are raw storage:
+ *      an element is constructed in its slot when it is enqueued and is
+ *      destroyed as soon as it is dequeued, so `Elem` need not be default
+ *      constructible. Huge arrays of trivially copyable elements are mapped
+ *      from the OS directly only if `Alloc` is `std::allocator<Elem>`.
  */
-template <typename Elem>
-class CircArrayQueue : public IQueue<Elem, CircArrayQueue>
+template <typename Elem, CapacityMode Mode = ExactCapacity,
+          ResizePolicy Policy = GeometricResizing<>,
+          typename Alloc = std::allocator<Elem>>
+class CircArrayQueue
+    : public IQueue<Elem, CircArrayQueue,
+                    CircArrayQueue<Elem, Mode, Policy, Alloc>>
 {
+    static_assert(std::is_same_v<typename Alloc::value_type, Elem>,
+                  "allocator value type must be the element type");
+
     // Parent class, which is allowed to access the private impl methods
-    friend class IQueue<Elem, CircArrayQueue>;
+    friend class IQueue<Elem, CircArrayQueue,
+                        CircArrayQueue<Elem, Mode, Policy, Alloc>>;
+
+    using AllocTraits = std::allocator_traits<Alloc>;
+
+    // Whether move assignment can always take over the array of the other
+    // queue, rather than moving its elements one by one
+    static constexpr bool moves_storage_ {
+        AllocTraits::propagate_on_container_move_assignment::value ||
+        AllocTraits::is_always_equal::value
+    };
 
 public:
+    /** Type of the allocator. */
+    using allocator_type = Alloc;
+
     /**
      * @brief Creates an empty queue.
      *
      * @param init_cap The initially anticipated maximum number of elements to
      *      be stored in the queue.
+     * @param alloc The allocator to allocate memory with.
      * @note Memory will be allocated according to `init_cap` and the element
-     *      type `Elem`.
+     *      type `Elem`, after `init_cap` is raised to the minimum capacity of
+     *      the resizing policy and fitted by the capacity mode. Allocation is
+     *      deferred until the first element is enqueued or memory is reserved,
+     *      so creating a queue that is never used costs no allocation.
      */
-    CircArrayQueue(std::size_t init_cap = 4096);
+    CircArrayQueue(std::size_t init_cap = 4096, Alloc const& alloc = Alloc {});
+    /** Creates an empty queue that allocates memory with `alloc`. */
+    explicit CircArrayQueue(Alloc const& alloc);
     ~CircArrayQueue();
 
-    /** Copy-constructs a new queue from an existing queue. */
+    /**
+     * Copy-constructs a new queue from an existing queue, with the allocator
+     * that `std::allocator_traits<Alloc>` selects for a copy.
+     */
     CircArrayQueue(CircArrayQueue const&);
+    /** Copy-constructs a new queue from an existing queue, with `alloc`. */
+    CircArrayQueue(CircArrayQueue const&, Alloc const& alloc);
     /** Move-constructs a new queue from an existing queue. */
     CircArrayQueue(CircArrayQueue&&) noexcept;
+    /**
+     * Move-constructs a new queue from an existing queue, with `alloc`, which
+     * moves the elements one by one unless `alloc` equals the allocator of the
+     * existing queue. The existing queue is left empty either way.
+     */
+    CircArrayQueue(CircArrayQueue&&, Alloc const& alloc);
 
     /** Copy-assigns an existing queue to this queue. */
     CircArrayQueue& operator=(CircArrayQueue const&);
-    /** Move-assigns an existing queue to this queue. */
-    CircArrayQueue& operator=(CircArrayQueue&&) noexcept;
+    /**
+     * Move-assigns an existing queue to this queue, which moves the elements
+     * one by one if the allocator is not propagated and the allocators of the
+     * two queues are not equal.
+     */
+    CircArrayQueue& operator=(CircArrayQueue&&) noexcept(moves_storage_);
+
+    /** Gets a copy of the allocator of this queue. */
+    Alloc get_allocator() const noexcept;
 
     /**
      * @brief Maximum number of elements this queue can store without allocating
@@ -101,17 +292,139 @@ public:
      */
     std::size_t capacity() const noexcept;
 
+    /**
+     * @brief Ensures that this queue can store at least `n` elements without
+     * allocating additional memory.
+     *
+     * @param n The number of elements to reserve memory for.
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`, in which case this queue is unchanged.
+     * @note The queue will not shrink below the capacity reserved as elements
+     *      are removed, until `shrink_to_fit()` is called.
+     */
+    void reserve(std::size_t n);
+
+    /**
+     * @brief Reduces the capacity of this queue to fit its number of elements.
+     *
+     * The capacity will not be reduced below the minimum capacity of the
+     * resizing policy. Any capacity reserved by `reserve()` is released.
+     *
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`, in which case the capacity is unchanged.
+     */
+    void shrink_to_fit();
+
+    /**
+     * @brief Views the elements of this queue as contiguous segments of the
+     * underlying array, without copying them.
+     *
+     * The elements are in the first segment followed by the second, which is
+     * empty unless the elements wrap around the end of the array. Both are
+     * empty if this queue is empty.
+     *
+     * @return The two segments, in the queue order.
+     * @note The segments are invalidated by any operation that adds or removes
+     *      elements.
+     */
+    std::array<std::span<Elem const>, 2> segments() const noexcept;
+
+    /**
+     * @brief Makes room for `n` elements after the last element of this queue
+     * and views the free slots as contiguous segments of the underlying array,
+     * so that they can be written directly, e.g. by `read()` or `recv()`.
+     *
+     * The slots are in the first segment followed by the second, which is
+     * empty unless the slots wrap around the end of the array. The elements
+     * written are not part of this queue until they are committed.
+     *
+     * @param n The number of slots to make room for.
+     * @return The two segments, which have `n` slots in total.
+     * @throws std::bad_alloc if memory cannot be allocated.
+     * @note The segments are invalidated by any operation other than
+     *      `commit()`. This operation is available only if `Elem` is
+     *      trivially copyable.
+     */
+    std::array<std::span<Elem>, 2> prepare(std::size_t n)
+        requires std::is_trivially_copyable_v<Elem>;
+
+    /**
+     * @brief Adds the first `n` elements written to the slots last prepared to
+     * the end of this queue.
+     *
+     * @param n The number of elements to add, which must not exceed the number
+     *      of slots last prepared.
+     * @throws std::logic_error if `n` exceeds the number of slots last
+     *      prepared, which is none once this queue is modified otherwise, in
+     *      which case no element is added.
+     * @note The slots prepared are used up by a commit, even if fewer than all
+     *      of them are committed. This operation is available only if `Elem`
+     *      is trivially copyable.
+     */
+    void commit(std::size_t n)
+        requires std::is_trivially_copyable_v<Elem>;
+
 private:
-    std::unique_ptr<Elem[]> elems_;
-    std::size_t             capacity_;
-    std::size_t             start_idx_ { 0 };
-    std::size_t             num_elems_ { 0 };
+    [[no_unique_address]] Alloc alloc_;
+    Elem*       elems_ { nullptr };   // nullptr until the first enqueue
+    std::size_t capacity_;
+    std::size_t start_idx_ { 0 };
+    std::size_t num_elems_ { 0 };
+    std::size_t reserved_ { 0 };   // capacity floor set by reserve()
+    std::size_t prepared_ { 0 };   // slots handed out by prepare()
+
+    // Arrays of trivially copyable elements at least this many bytes large
+    // are mapped from the OS directly, so that they can be grown in place.
+    static constexpr std::size_t map_threshold_ { std::size_t { 1 } << 24 };
+
+    // Determines if an array of capacity `n` is mapped from the OS directly.
+    static constexpr bool maps_pages_(std::size_t n) noexcept;
+    // Allocates uninitialized storage for `n` elements.
+    Elem*                 allocate_(std::size_t n);
+    // Frees storage for `n` elements obtained from allocate_(n).
+    void                  deallocate_(Elem* arr, std::size_t n) noexcept;
+    // Destroys all elements and frees the underlying array.
+    void                  release_() noexcept;
+    // Takes over the array and the elements of `other`, leaving it empty,
+    // after this queue has been released.
+    void                  steal_(CircArrayQueue& other) noexcept;
+    // Constructs an element in `slot` through the allocator.
+    template <typename... Args>
+    void                  construct_(Elem* slot, Args&&... args);
+    // Destroys the element in `slot` through the allocator.
+    void                  destroy_(Elem* slot) noexcept;
 
+    // Maps a position past the end onto the underlying array.
+    std::size_t wrap_(std::size_t i) const noexcept;
     // Gets the array position of the last element in this queue.
     std::size_t end_idx_() const noexcept;
-    // Grows (factor > 0) or shrinks (factor <= 0) the underlying array.
-    // Take 1 to grow, -1 to shrink by convention.
+    // Grows (factor > 0) or shrinks (factor <= 0) the underlying array as
+    // the resizing policy determines. Take 1 to grow, -1 to shrink by
+    // convention.
     void        resize_(std::int8_t factor);
+    // Relocates all elements to the start of a new array of capacity
+    // `new_cap`, by memcpy, move or copy in order of preference.
+    void        reallocate_(std::size_t new_cap);
+    // Grows a mapped array in place (or remaps its pages elsewhere) to
+    // capacity `new_cap`, without copying elements other than one segment.
+    void        remap_(std::size_t new_cap);
+    // Grows the underlying array as the resizing policy determines until `n`
+    // elements fit, allocating it if deferred.
+    void        grow_to_(std::size_t n);
+
+    // Constructs `n` elements at `dst` from a source range at `src`, and
+    // gets the iterator past the last source element consumed.
+    template <std::input_iterator InputIt>
+    InputIt construct_n_(InputIt src, std::size_t n, Elem* dst);
+    // Moves `n` elements at `src` to an output range at `out`, and gets the
+    // iterator past the last element written. Elements at `src` are left for
+    // the caller to destroy.
+    template <std::output_iterator<Elem> OutputIt>
+    static OutputIt move_n_(Elem* src, std::size_t n, OutputIt out);
+    // Moves, or copies if moving may throw, `n` elements at `src` to the end
+    // of this queue, which has room for them. Elements at `src` are left for
+    // the caller to destroy.
+    void append_n_(Elem* src, std::size_t n);
 
     /** Number of elements in the queue. */
     std::size_t size_() const noexcept;
@@ -175,9 +488,11 @@ private:
      * @brief Removes the element at end of this queue.
      *
      * @throws dsa::EmptyQueueError if this queue is empty.
-     * @note Removing an element will trigger memory deallocation (and
-     *      re-allocation of half the size) only when the number of elements in
-     *      this queue is a quarter of the current capacity.
+     * @note The removed element is destroyed immediately. Removing an element
+     *      will trigger memory deallocation (and re-allocation of a smaller
+     *      size) only when the resizing policy determines to shrink, which is
+     *      when the number of elements in this queue is less than a quarter of
+     *      the current capacity by default.
      */
     void dequeue_();
 
@@ -185,8 +500,8 @@ private:
      * @brief Creates a new element in-place after the last element of this
      * queue.
      *
-     * The new element is constructed in-place using all of the arguments
-     * passed to this member function.
+     * The new element is constructed in-place, directly in its array slot,
+     * using all of the arguments passed to this member function.
      *
      * @tparam Args Types of the arguments to be passed to the constructor of
      *      the element type `Elem`.
@@ -199,8 +514,81 @@ private:
      */
     template <typename... Args>
     void emplace_(Args&&... args);
+
+    /**
+     * @brief Adds all elements in a range to the end of this queue.
+     *
+     * If the range is a forward range, memory is reserved once for all of its
+     * elements, which are then copied into at most two contiguous segments
+     * of the underlying array, using `memcpy` when the range is contiguous
+     * and `Elem` is trivially copyable.
+     *
+     * @tparam InputIt Type of the iterator to the range.
+     * @tparam Sentinel Type of the sentinel marking the end of the range.
+     * @param first Iterator to the first element of the range.
+     * @param last Sentinel marking the end of the range.
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`, in which case the elements added before the exception
+     *      is thrown remain in this queue.
+     */
+    template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+    void enqueue_range_(InputIt first, Sentinel last);
+
+    /**
+     * @brief Removes the first `n` elements of this queue and writes them out.
+     *
+     * Elements are moved out of at most two contiguous segments of the
+     * underlying array, using `memcpy` when the output range is contiguous
+     * and `Elem` is trivially copyable.
+     *
+     * @tparam OutputIt Type of the iterator to the output range.
+     * @param n Number of elements to remove.
+     * @param out Iterator to the beginning of the output range.
+     * @return Iterator past the last element written.
+     * @throws dsa::EmptyQueueError if this queue has fewer than `n` elements,
+     *      in which case no element is removed.
+     */
+    template <std::output_iterator<Elem> OutputIt>
+    OutputIt dequeue_n_(std::size_t n, OutputIt out);
+
+    /**
+     * @brief Moves all elements of another queue to the end of this queue,
+     * leaving the other queue empty.
+     *
+     * If this queue is empty, the two queues swap their underlying arrays
+     * when their allocators are equal, so that no element is moved and the
+     * other queue keeps an array to refill. Otherwise, memory is reserved once
+     * for all elements, which are then moved from at most two contiguous
+     * segments of the other array into at most two of this one, using
+     * `memcpy` when `Elem` is trivially copyable.
+     *
+     * @param other The queue whose elements are to be moved.
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`, in which case both queues are unchanged.
+     * @note Elements are copied instead if moving them may throw.
+     */
+    void splice_(CircArrayQueue& other);
 };
 
+/** Aliases of queue types that allocate memory from a memory resource. */
+namespace pmr
+{
+
+/**
+ * @brief Circular array queue that allocates memory from a
+ *      `std::pmr::memory_resource`, e.g. `std::pmr::monotonic_buffer_resource`.
+ *
+ * The memory resource is passed to the constructor, and is not propagated on
+ * copy or move assignment.
+ */
+template <typename Elem, CapacityMode Mode = ExactCapacity,
+          ResizePolicy Policy = GeometricResizing<>>
+using CircArrayQueue =
+    dsa::CircArrayQueue<Elem, Mode, Policy,
+                        std::pmr::polymorphic_allocator<Elem>>;
+
+}   // namespace pmr
+
 }   // namespace dsa
 
 #include "circ_array_queue.inl"
@@ -33,161 +33,688 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /*** Inline definitions ***/
 #include "circ_array_queue.hpp"
 
+#include <algorithm>     // min(), max()
+#include <cstring>       // memcpy(), memmove()
+#include <limits>        // numeric_limits<T>
+#include <new>           // bad_alloc, bad_array_new_length
+#include <stdexcept>     // logic_error
+#include <type_traits>   // is_trivially_copyable_v<T>, ...
+#include <utility>       // exchange(), move_if_noexcept(), swap()
+
+#if defined(__linux__)
+#include <sys/mman.h>   // mmap(), mremap(), munmap()
+#endif
+
 namespace dsa
 {
 
 // === PUBLIC METHODS ===
 
-template <typename Elem>
-CircArrayQueue<Elem>::CircArrayQueue(std::size_t init_cap)
-    : elems_ { new Elem[init_cap] }, capacity_ { init_cap } {}
-
-template <typename Elem>
-CircArrayQueue<Elem>::~CircArrayQueue() {}
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+CircArrayQueue<Elem, Mode, Policy, Alloc>::CircArrayQueue(std::size_t  init_cap,
+                                                          Alloc const& alloc)
+    : alloc_ { alloc },
+      capacity_ { Mode::fit(std::max(init_cap, Policy::min_capacity)) } {}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+CircArrayQueue<Elem, Mode, Policy, Alloc>::CircArrayQueue(Alloc const& alloc)
+    : CircArrayQueue { 4096, alloc } {}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+CircArrayQueue<Elem, Mode, Policy, Alloc>::~CircArrayQueue() {
+    release_();
+}
 
 // clang-format off
 
-template <typename Elem>
-CircArrayQueue<Elem>::CircArrayQueue(CircArrayQueue const& other)
-    : elems_ { new Elem[other.capacity_] },
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+CircArrayQueue<Elem, Mode, Policy, Alloc>::CircArrayQueue(
+    CircArrayQueue const& other)
+    : CircArrayQueue { other,
+                       AllocTraits::select_on_container_copy_construction(
+                           other.alloc_) }
+{}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+CircArrayQueue<Elem, Mode, Policy, Alloc>::CircArrayQueue(
+    CircArrayQueue const& other, Alloc const& alloc)
+    : alloc_ { alloc },
       capacity_ { other.capacity_ },
-      num_elems_ { other.num_elems_ }
+      reserved_ { other.reserved_ }
+{
+    if (other.num_elems_ == 0) return;
+
+    // Elements are laid out from the start of the array in the copy
+    elems_ = allocate_(capacity_);
+    try {
+        for (; num_elems_ < other.num_elems_; ++num_elems_) {
+            construct_(
+                elems_ + num_elems_,
+                other.elems_[other.wrap_(other.start_idx_ + num_elems_)]);
+        }
+    }
+    catch (...) {
+        release_();
+        throw;
+    }
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+CircArrayQueue<Elem, Mode, Policy, Alloc>::CircArrayQueue(
+    CircArrayQueue&& other) noexcept
+    : alloc_ { std::move(other.alloc_) }
 {
-    for (std::size_t i { 0 }; i < other.num_elems_; ++i) 
-        elems_[i] = other.elems_[i];
+    steal_(other);
 }
 
-template <typename Elem>
-CircArrayQueue<Elem>::CircArrayQueue(CircArrayQueue&& other) noexcept
-    : elems_ { std::move(other.elems_) }, 
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+CircArrayQueue<Elem, Mode, Policy, Alloc>::CircArrayQueue(
+    CircArrayQueue&& other, Alloc const& alloc)
+    : alloc_ { alloc },
       capacity_ { other.capacity_ },
-      start_idx_ { other.start_idx_ }, 
-      num_elems_ { other.num_elems_ } 
+      reserved_ { other.reserved_ }
 {
-    other.elems_ = nullptr;
-    other.capacity_ = 0;
-    other.start_idx_ = 0;
-    other.num_elems_ = 0;
+    if (alloc_ == other.alloc_) {
+        steal_(other);
+        return;
+    }
+    if (other.num_elems_ == 0) return;
+
+    // Memory of the other allocator cannot be taken over, so the elements
+    // are moved one by one, and laid out from the start of the array
+    elems_ = allocate_(capacity_);
+    try {
+        for (; num_elems_ < other.num_elems_; ++num_elems_) {
+            construct_(elems_ + num_elems_,
+                       std::move_if_noexcept(other.elems_[other.wrap_(
+                           other.start_idx_ + num_elems_)]));
+        }
+    }
+    catch (...) {
+        release_();
+        throw;
+    }
+    other.release_();
 }
 
 // clang-format on
 
-template <typename Elem>
-CircArrayQueue<Elem>&
-    CircArrayQueue<Elem>::operator=(CircArrayQueue const& other) {
-    elems_     = std::unique_ptr<Elem[]> { new Elem[other.capacity_] };
-    capacity_  = other.capacity_;
-    start_idx_ = other.start_idx_;
-    num_elems_ = other.num_elems_;
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+CircArrayQueue<Elem, Mode, Policy, Alloc>&
+    CircArrayQueue<Elem, Mode, Policy, Alloc>::operator=(
+        CircArrayQueue const& other) {
+    if (this == &other) return *this;
+
+    constexpr bool propagates {
+        AllocTraits::propagate_on_container_copy_assignment::value
+    };
+    auto copy = CircArrayQueue { other, propagates ? other.alloc_ : alloc_ };
+    release_();
+    if constexpr (propagates) alloc_ = other.alloc_;
+    steal_(copy);
+
     return *this;
 }
 
-template <typename Elem>
-CircArrayQueue<Elem>&
-    CircArrayQueue<Elem>::operator=(CircArrayQueue&& other) noexcept {
-    std::swap(elems_, other.elems_);
-
-    capacity_        = other.capacity_;
-    start_idx_       = other.start_idx_;
-    num_elems_       = other.num_elems_;
-
-    other.capacity_  = 0;
-    other.start_idx_ = 0;
-    other.num_elems_ = 0;
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+CircArrayQueue<Elem, Mode, Policy, Alloc>&
+    CircArrayQueue<Elem, Mode, Policy, Alloc>::operator=(
+        CircArrayQueue&& other) noexcept(moves_storage_) {
+    if (this == &other) return *this;
+
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+        release_();
+        alloc_ = std::move(other.alloc_);
+        steal_(other);
+    } else if (alloc_ == other.alloc_) {
+        release_();
+        steal_(other);
+    } else {
+        // Keep the allocator of this queue, which cannot free memory of the
+        // other allocator, and move the elements one by one
+        auto moved = CircArrayQueue { std::move(other), alloc_ };
+        release_();
+        steal_(moved);
+    }
 
     return *this;
 }
 
-template <typename Elem>
-std::size_t CircArrayQueue<Elem>::capacity() const noexcept {
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+Alloc CircArrayQueue<Elem, Mode, Policy, Alloc>::get_allocator()
+    const noexcept {
+    return alloc_;
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+std::size_t
+    CircArrayQueue<Elem, Mode, Policy, Alloc>::capacity() const noexcept {
     return capacity_;
 }
 
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::reserve(std::size_t n) {
+    prepared_ = 0;
+    if (n > capacity_) {
+        reallocate_(Mode::fit(n));
+    } else if (!elems_ && n > 0) {
+        elems_ = allocate_(capacity_);   // deferred since construction
+    }
+    reserved_ = std::max(reserved_, n);
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::shrink_to_fit() {
+    reserved_ = 0;
+    prepared_ = 0;
+    std::size_t new_cap { Mode::fit(
+        std::max(num_elems_, Policy::min_capacity)) };
+    if (new_cap >= capacity_) return;
+    if (elems_) {
+        reallocate_(new_cap);
+    } else {
+        capacity_ = new_cap;   // nothing to free before the first enqueue
+    }
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+std::array<std::span<Elem const>, 2>
+    CircArrayQueue<Elem, Mode, Policy, Alloc>::segments() const noexcept {
+    // Occupied slots from the start index up to the end of the array,
+    // followed by those from the start of the array
+    std::size_t n1 { std::min(num_elems_, capacity_ - start_idx_) };
+    return { std::span<Elem const> { elems_ + start_idx_, n1 },
+             std::span<Elem const> { elems_, num_elems_ - n1 } };
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+std::array<std::span<Elem>, 2>
+    CircArrayQueue<Elem, Mode, Policy, Alloc>::prepare(std::size_t n)
+    requires std::is_trivially_copyable_v<Elem>
+{
+    grow_to_(num_elems_ + n);
+
+    // Free slots from the end index up to the end of the array, followed
+    // by those from the start of the array
+    std::size_t end_idx { end_idx_() };
+    std::size_t n1 { std::min(n, capacity_ - end_idx) };
+    prepared_ = n;
+    return { std::span<Elem> { elems_ + end_idx, n1 },
+             std::span<Elem> { elems_, n - n1 } };
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::commit(std::size_t n)
+    requires std::is_trivially_copyable_v<Elem>
+{
+    if (n > prepared_) {
+        throw std::logic_error { "commit more elements than prepared" };
+    }
+    prepared_ = 0;
+    num_elems_ += n;
+}
+
 // === PRIVATE METHODS ===
 
-template <typename Elem>
-std::size_t CircArrayQueue<Elem>::end_idx_() const noexcept {
-    return (start_idx_ + num_elems_) % capacity_;
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+constexpr bool
+    CircArrayQueue<Elem, Mode, Policy, Alloc>::maps_pages_(
+        std::size_t n) noexcept {
+#if defined(__linux__)
+    // Memory of any other allocator is left to the allocator
+    return std::is_same_v<Alloc, std::allocator<Elem>> &&
+           std::is_trivially_copyable_v<Elem> && alignof(Elem) <= 4096 &&
+           n >= map_threshold_ / sizeof(Elem);
+#else
+    return false;
+#endif
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+Elem* CircArrayQueue<Elem, Mode, Policy, Alloc>::allocate_(std::size_t n) {
+    if (n == 0) return nullptr;
+#if defined(__linux__)
+    if (maps_pages_(n)) {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(Elem)) {
+            throw std::bad_array_new_length {};
+        }
+        void* arr = ::mmap(nullptr, n * sizeof(Elem), PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (arr == MAP_FAILED) throw std::bad_alloc {};
+        return static_cast<Elem*>(arr);
+    }
+#endif
+    return AllocTraits::allocate(alloc_, n);
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::deallocate_(Elem*       arr,
+                                                     std::size_t n) noexcept {
+    if (!arr) return;
+#if defined(__linux__)
+    if (maps_pages_(n)) {
+        ::munmap(arr, n * sizeof(Elem));
+        return;
+    }
+#endif
+    AllocTraits::deallocate(alloc_, arr, n);
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::release_() noexcept {
+    if (!elems_) return;
+    for (std::size_t i { 0 }; i < num_elems_; ++i) {
+        destroy_(elems_ + wrap_(start_idx_ + i));
+    }
+    deallocate_(elems_, capacity_);
+    elems_     = nullptr;
+    num_elems_ = 0;
+    prepared_  = 0;
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::steal_(
+    CircArrayQueue& other) noexcept {
+    elems_     = std::exchange(other.elems_, nullptr);
+    capacity_  = std::exchange(other.capacity_, 0);
+    start_idx_ = std::exchange(other.start_idx_, 0);
+    num_elems_ = std::exchange(other.num_elems_, 0);
+    reserved_  = std::exchange(other.reserved_, 0);
+    // Slots prepared by either queue are used up
+    prepared_       = 0;
+    other.prepared_ = 0;
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+template <typename... Args>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::construct_(Elem*     slot,
+                                                           Args&&... args) {
+    AllocTraits::construct(alloc_, slot, std::forward<Args>(args)...);
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::destroy_(Elem* slot) noexcept {
+    AllocTraits::destroy(alloc_, slot);
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+std::size_t CircArrayQueue<Elem, Mode, Policy, Alloc>::wrap_(
+    std::size_t i) const noexcept {
+    return Mode::wrap(i, capacity_);
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+std::size_t
+    CircArrayQueue<Elem, Mode, Policy, Alloc>::end_idx_() const noexcept {
+    return wrap_(start_idx_ + num_elems_);
 }
 
-template <typename Elem>
-std::size_t CircArrayQueue<Elem>::size_() const noexcept {
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+std::size_t CircArrayQueue<Elem, Mode, Policy, Alloc>::size_() const noexcept {
     return num_elems_;
 }
 
-template <typename Elem>
-bool CircArrayQueue<Elem>::empty_() const noexcept {
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+bool CircArrayQueue<Elem, Mode, Policy, Alloc>::empty_() const noexcept {
     return num_elems_ == 0;
 }
 
-template <typename Elem>
-void CircArrayQueue<Elem>::iter_(
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::iter_(
     std::function<void(Elem const&)> action) const {
     for (std::size_t i { 0 }; i < num_elems_; ++i) {
-        action(elems_[(start_idx_ + i) % capacity_]);
+        action(elems_[wrap_(start_idx_ + i)]);
     }
 }
 
-template <typename Elem>
-Elem& CircArrayQueue<Elem>::front_() {
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+Elem& CircArrayQueue<Elem, Mode, Policy, Alloc>::front_() {
     return const_cast<Elem&>(
-        const_cast<const CircArrayQueue<Elem>*>(this)->front_());
+        const_cast<const CircArrayQueue<Elem, Mode, Policy, Alloc>*>(this)
+            ->front_());
 }
 
-template <typename Elem>
-Elem const& CircArrayQueue<Elem>::front_() const {
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+Elem const& CircArrayQueue<Elem, Mode, Policy, Alloc>::front_() const {
     if (num_elems_ == 0) throw EmptyQueueError {};
     return elems_[start_idx_];
 }
 
-template <typename Elem>
-void CircArrayQueue<Elem>::resize_(std::int8_t factor) {
-    std::size_t new_cap { 0 };
-    if (factor > 0 && num_elems_ == capacity_) {
-        new_cap = capacity_ * 2;
-    } else if (factor < 0 && capacity_ >= 2 && num_elems_ * 4 < capacity_) {
-        new_cap = capacity_ / 2;
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::resize_(std::int8_t factor) {
+    if (factor > 0) {
+        if (num_elems_ == capacity_) {
+            reallocate_(Mode::fit(Policy::grow(capacity_)));
+        } else if (!elems_) {
+            elems_ = allocate_(capacity_);   // deferred since construction
+        }
+    } else if (elems_) {
+        // Never shrink below the capacity reserved
+        std::size_t new_cap { Mode::fit(
+            std::max(Policy::shrink(num_elems_, capacity_), reserved_)) };
+        if (new_cap < capacity_) reallocate_(new_cap);
+    }
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::reallocate_(
+    std::size_t new_cap) {
+    if (elems_ && new_cap > capacity_ && maps_pages_(capacity_)) {
+        remap_(new_cap);
+        return;
     }
 
-    if (new_cap > 0) {
-        auto arr = std::unique_ptr<Elem[]> { new Elem[new_cap] };
-        for (std::size_t i { 0 }; i < num_elems_; ++i) {
-            arr[i] = elems_[(start_idx_ + i) % capacity_];
+    // Occupied slots from the start index up to the end of the array,
+    // followed by those from the start of the array
+    Elem*       arr { allocate_(new_cap) };
+    std::size_t n1 { std::min(num_elems_, capacity_ - start_idx_) };
+    std::size_t n2 { num_elems_ - n1 };
+
+    if constexpr (std::is_trivially_copyable_v<Elem>) {
+        if (n1 > 0) std::memcpy(arr, elems_ + start_idx_, n1 * sizeof(Elem));
+        if (n2 > 0) std::memcpy(arr + n1, elems_, n2 * sizeof(Elem));
+    } else {
+        // Elements are moved if that cannot throw, or else copied, so that
+        // this queue is unchanged should copying throw
+        std::size_t num_built { 0 };
+        try {
+            for (Elem* src { elems_ + start_idx_ }; num_built < n1;
+                 ++num_built) {
+                construct_(arr + num_built, std::move_if_noexcept(*src++));
+            }
+            for (; num_built < num_elems_; ++num_built) {
+                construct_(arr + num_built,
+                           std::move_if_noexcept(elems_[num_built - n1]));
+            }
         }
-        elems_     = std::move(arr);
-        capacity_  = new_cap;
-        start_idx_ = 0;
+        catch (...) {
+            for (std::size_t i { 0 }; i < num_built; ++i) destroy_(arr + i);
+            deallocate_(arr, new_cap);
+            throw;
+        }
+        for (std::size_t i { 0 }; i < n1; ++i) {
+            destroy_(elems_ + start_idx_ + i);
+        }
+        for (std::size_t i { 0 }; i < n2; ++i) destroy_(elems_ + i);
     }
+
+    deallocate_(elems_, capacity_);
+    elems_     = arr;
+    capacity_  = new_cap;
+    start_idx_ = 0;
 }
 
-template <typename Elem>
-void CircArrayQueue<Elem>::enqueue_(Elem const& elem) {
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::remap_(std::size_t new_cap) {
+#if defined(__linux__)
+    if constexpr (std::is_trivially_copyable_v<Elem>) {
+        if (new_cap > std::numeric_limits<std::size_t>::max() / sizeof(Elem)) {
+            throw std::bad_array_new_length {};
+        }
+        void* arr = ::mremap(elems_, capacity_ * sizeof(Elem),
+                             new_cap * sizeof(Elem), MREMAP_MAYMOVE);
+        if (arr == MAP_FAILED) throw std::bad_alloc {};
+        elems_ = static_cast<Elem*>(arr);
+
+        // Unwrap the elements by relocating the smaller of the two segments:
+        // either the one at the start of the array to the old end of the
+        // array, or the one up to the old end of the array to the new end
+        std::size_t n1 { std::min(num_elems_, capacity_ - start_idx_) };
+        std::size_t n2 { num_elems_ - n1 };
+        if (n2 > 0 && n2 <= n1 && n2 <= new_cap - capacity_) {
+            std::memcpy(elems_ + capacity_, elems_, n2 * sizeof(Elem));
+        } else if (n2 > 0) {
+            std::memmove(elems_ + new_cap - n1, elems_ + start_idx_,
+                         n1 * sizeof(Elem));
+            start_idx_ = new_cap - n1;
+        }
+        capacity_ = new_cap;
+    }
+#else
+    reallocate_(new_cap);
+#endif
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::grow_to_(std::size_t n) {
+    if (n <= capacity_ && (elems_ || n == 0)) return;
+    std::size_t new_cap { capacity_ };
+    while (new_cap < n) new_cap = Mode::fit(Policy::grow(new_cap));
+    reallocate_(new_cap);
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+template <std::input_iterator InputIt>
+InputIt CircArrayQueue<Elem, Mode, Policy, Alloc>::construct_n_(
+    InputIt src, std::size_t n, Elem* dst) {
+    if constexpr (ContiguousIteratorOf<InputIt, Elem> &&
+                  std::is_trivially_copyable_v<Elem>) {
+        if (n > 0) std::memcpy(dst, std::to_address(src), n * sizeof(Elem));
+        return src + n;
+    } else {
+        std::size_t num_built { 0 };
+        try {
+            for (; num_built < n; ++num_built, ++src) {
+                construct_(dst + num_built, *src);
+            }
+        }
+        catch (...) {
+            for (std::size_t i { 0 }; i < num_built; ++i) destroy_(dst + i);
+            throw;
+        }
+        return src;
+    }
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+template <std::output_iterator<Elem> OutputIt>
+OutputIt CircArrayQueue<Elem, Mode, Policy, Alloc>::move_n_(Elem*       src,
+                                                     std::size_t n,
+                                                     OutputIt    out) {
+    if constexpr (ContiguousIteratorOf<OutputIt, Elem> &&
+                  std::is_trivially_copyable_v<Elem>) {
+        if (n > 0) std::memcpy(std::to_address(out), src, n * sizeof(Elem));
+        return out + n;
+    } else {
+        for (std::size_t i { 0 }; i < n; ++i) *out++ = std::move(src[i]);
+        return out;
+    }
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::append_n_(Elem*       src,
+                                                          std::size_t n) {
+    auto first = [src] {
+        if constexpr (std::is_nothrow_move_constructible_v<Elem> &&
+                      !std::is_trivially_copyable_v<Elem>) {
+            return std::make_move_iterator(src);
+        } else {
+            return static_cast<Elem const*>(src);
+        }
+    }();
+
+    // Free slots from the end index up to the end of the array, followed by
+    // those from the start of the array
+    std::size_t end_idx { end_idx_() };
+    std::size_t n1 { std::min(n, capacity_ - end_idx) };
+    first      = construct_n_(std::move(first), n1, elems_ + end_idx);
+    num_elems_ += n1;
+    construct_n_(std::move(first), n - n1, elems_);
+    num_elems_ += n - n1;
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::enqueue_(Elem const& elem) {
+    prepared_ = 0;
     resize_(1);
-    elems_[end_idx_()] = elem;
-    num_elems_         += 1;
+    construct_(elems_ + end_idx_(), elem);
+    num_elems_ += 1;
 }
 
-template <typename Elem>
-void CircArrayQueue<Elem>::enqueue_(Elem&& elem) {
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::enqueue_(Elem&& elem) {
+    prepared_ = 0;
     resize_(1);
-    elems_[end_idx_()] = std::move(elem);
-    num_elems_         += 1;
+    construct_(elems_ + end_idx_(), std::move(elem));
+    num_elems_ += 1;
 }
 
-template <typename Elem>
-void CircArrayQueue<Elem>::dequeue_() {
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::dequeue_() {
     if (num_elems_ == 0) throw EmptyQueueError { "dequeue from empty queue" };
-    start_idx_ = (start_idx_ + 1) % capacity_;
+    prepared_ = 0;
+    destroy_(elems_ + start_idx_);
+    start_idx_ = wrap_(start_idx_ + 1);
     num_elems_ -= 1;
     resize_(-1);
 }
 
-template <typename Elem>
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
 template <typename... Args>
-void CircArrayQueue<Elem>::emplace_(Args&&... args) {
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::emplace_(Args&&... args) {
+    prepared_ = 0;
     resize_(1);
-    elems_[end_idx_()] = Elem { std::forward<Args>(args)... };
-    num_elems_         += 1;
+    construct_(elems_ + end_idx_(), std::forward<Args>(args)...);
+    num_elems_ += 1;
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::enqueue_range_(InputIt  first,
+                                                       Sentinel last) {
+    prepared_ = 0;
+    if constexpr (std::forward_iterator<InputIt>) {
+        auto n = static_cast<std::size_t>(std::ranges::distance(first, last));
+        grow_to_(num_elems_ + n);
+
+        // Free slots from the end index up to the end of the array, followed
+        // by those from the start of the array
+        std::size_t end_idx { end_idx_() };
+        std::size_t n1 { std::min(n, capacity_ - end_idx) };
+        first      = construct_n_(std::move(first), n1, elems_ + end_idx);
+        num_elems_ += n1;
+        construct_n_(std::move(first), n - n1, elems_);
+        num_elems_ += n - n1;
+    } else {
+        for (; first != last; ++first) enqueue_(*first);
+    }
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+template <std::output_iterator<Elem> OutputIt>
+OutputIt CircArrayQueue<Elem, Mode, Policy, Alloc>::dequeue_n_(std::size_t n,
+                                                       OutputIt    out) {
+    if (n > num_elems_) {
+        throw EmptyQueueError { "dequeue more elements than the queue has" };
+    }
+    prepared_ = 0;
+
+    if constexpr (std::is_trivially_copyable_v<Elem>) {
+        // Occupied slots from the start index up to the end of the array,
+        // followed by those from the start of the array
+        std::size_t n1 { std::min(n, capacity_ - start_idx_) };
+        out        = move_n_(elems_ + start_idx_, n1, std::move(out));
+        out        = move_n_(elems_, n - n1, std::move(out));
+        start_idx_ = wrap_(start_idx_ + n);
+        num_elems_ -= n;
+    } else {
+        // Keep this queue valid should moving an element out throw
+        for (; n > 0; --n) {
+            out = move_n_(elems_ + start_idx_, 1, std::move(out));
+            destroy_(elems_ + start_idx_);
+            start_idx_ = wrap_(start_idx_ + 1);
+            num_elems_ -= 1;
+        }
+    }
+    resize_(-1);
+    return out;
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          typename Alloc>
+void CircArrayQueue<Elem, Mode, Policy, Alloc>::splice_(CircArrayQueue& other) {
+    if (other.num_elems_ == 0) return;
+    prepared_       = 0;
+    other.prepared_ = 0;
+
+    // Swap the arrays, so that the other queue keeps an array to refill,
+    // unless either would fall short of the capacity reserved by its queue
+    if (num_elems_ == 0 && alloc_ == other.alloc_ &&
+        other.capacity_ >= reserved_ && capacity_ >= other.reserved_) {
+        std::swap(elems_, other.elems_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(start_idx_, other.start_idx_);
+        std::swap(num_elems_, other.num_elems_);
+        return;
+    }
+
+    grow_to_(num_elems_ + other.num_elems_);
+
+    // Occupied slots of the other array from its start index up to its end,
+    // followed by those from its start
+    std::size_t n1 { std::min(other.num_elems_,
+                              other.capacity_ - other.start_idx_) };
+    std::size_t num_kept { num_elems_ };
+    try {
+        append_n_(other.elems_ + other.start_idx_, n1);
+        append_n_(other.elems_, other.num_elems_ - n1);
+    }
+    catch (...) {
+        while (num_elems_ > num_kept) {
+            num_elems_ -= 1;
+            destroy_(elems_ + end_idx_());
+        }
+        throw;
+    }
+
+    for (std::size_t i { 0 }; i < other.num_elems_; ++i) {
+        other.destroy_(other.elems_ + other.wrap_(other.start_idx_ + i));
+    }
+    other.start_idx_ = 0;
+    other.num_elems_ = 0;
 }
 
-}   // namespace dsa
\ No newline at end of file
+}   // namespace dsa
@@ -0,0 +1,219 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      concurrency.hpp
+ * @brief     Concurrency Utilities
+ * @details   Building blocks shared by the thread-safe implementations of the
+ *            Queue ADT.
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef QUEUE_CONCURRENCY_HPP
+#define QUEUE_CONCURRENCY_HPP
+
+#include <atomic>    // atomic<T>
+#include <chrono>    // steady_clock, duration<Rep, Period>
+#include <cstddef>   // size_t
+#include <cstdint>   // uint32_t
+#include <thread>    // this_thread::yield()
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#include <immintrin.h>   // _mm_pause()
+#endif
+
+#if defined(__linux__)
+#include <ctime>           // timespec, time_t
+#include <linux/futex.h>   // FUTEX_WAIT_PRIVATE, FUTEX_WAKE_PRIVATE
+#include <sys/syscall.h>   // SYS_futex
+#include <unistd.h>        // syscall()
+#endif
+
+namespace dsa
+{
+
+/**
+ * @brief Size in bytes of a cache line, i.e. the granularity at which cores
+ *      contend for memory.
+ *
+ * Data written by different threads is aligned to this size so that the
+ * threads do not invalidate each other's cache lines (false sharing).
+ *
+ * @note `std::hardware_destructive_interference_size` is not used as its value
+ *      may differ between translation units compiled with different flags,
+ *      which would change the layout of the types using it.
+ */
+inline constexpr std::size_t cache_line_size { 64 };
+
+/**
+ * @brief Hints the processor that the calling thread is busy-waiting, so that
+ *      it can save power and yield resources to a sibling hardware thread.
+ */
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield");
+#endif
+}
+
+/**
+ * @brief Exponential backoff for retrying a failed operation on a concurrent
+ *      queue.
+ *
+ * Each call busy-waits twice as long as the previous one, which spreads out
+ * threads that contend for the same index. Once the wait reaches `MaxPauses`
+ * pause instructions, the calling thread yields its time slice instead, so
+ * that a preempted thread it is waiting for gets to run.
+ *
+ * @tparam MaxPauses The longest busy-wait, in pause instructions. Defaults
+ *      to 64.
+ */
+template <std::uint32_t MaxPauses = 64>
+class Backoff
+{
+    std::uint32_t num_pauses_ { 1 };
+
+public:
+    /** Waits before the next retry. */
+    void operator()() noexcept {
+        if (num_pauses_ > MaxPauses) {
+            std::this_thread::yield();
+            return;
+        }
+        for (std::uint32_t i { 0 }; i < num_pauses_; ++i) cpu_relax();
+        num_pauses_ *= 2;
+    }
+};
+
+/**
+ * @brief Gets a small index that identifies the calling thread.
+ *
+ * Threads are numbered from zero in the order they first call this function,
+ * so a concurrent data structure can map threads onto a few slots or shards,
+ * e.g. by taking the index modulo their number, with little collision.
+ *
+ * @return The index of the calling thread.
+ */
+inline std::size_t this_thread_index() noexcept {
+    static auto             next_index = std::atomic<std::size_t> { 0 };
+    thread_local auto const index =
+        next_index.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+/**
+ * @brief Blocks the calling thread while `word` holds the value `old`, until
+ *      it is woken by `dsa::futex_wake()` on the same word.
+ *
+ * The thread may also wake up spuriously, so the caller must check its
+ * condition again. On Linux, the thread waits on a futex, in the kernel;
+ * elsewhere, it waits with `std::atomic::wait()`.
+ *
+ * @param word The word to wait on.
+ * @param old The value of the word to wait while.
+ */
+inline void futex_wait(std::atomic<std::uint32_t>& word,
+                       std::uint32_t               old) noexcept {
+#if defined(__linux__)
+    static_assert(sizeof(word) == sizeof(std::uint32_t));
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+              FUTEX_WAIT_PRIVATE, old, nullptr, nullptr, 0);
+#else
+    word.wait(old, std::memory_order_acquire);
+#endif
+}
+
+/**
+ * @brief Blocks the calling thread while `word` holds the value `old`, until
+ *      it is woken by `dsa::futex_wake()` on the same word, or until a timeout
+ *      expires.
+ *
+ * The thread may also wake up spuriously, so the caller must check its
+ * condition again. On Linux, the thread waits on a futex, in the kernel;
+ * elsewhere, as `std::atomic::wait()` cannot time out, it polls the word with
+ * backoff.
+ *
+ * @tparam Rep Arithmetic type of the number of ticks of the timeout.
+ * @tparam Period Tick period of the timeout.
+ * @param word The word to wait on.
+ * @param old The value of the word to wait while.
+ * @param timeout The maximum duration to wait for.
+ */
+template <typename Rep, typename Period>
+void futex_wait_for(std::atomic<std::uint32_t>&        word,
+                    std::uint32_t                      old,
+                    std::chrono::duration<Rep, Period> timeout) noexcept {
+    if (timeout <= timeout.zero()) return;
+#if defined(__linux__)
+    auto const ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count();
+    auto const ts = ::timespec { static_cast<std::time_t>(ns / 1'000'000'000),
+                                 static_cast<long>(ns % 1'000'000'000) };
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+              FUTEX_WAIT_PRIVATE, old, &ts, nullptr, 0);
+#else
+    auto const deadline = std::chrono::steady_clock::now() + timeout;
+    auto       backoff  = Backoff<> {};
+    while (word.load(std::memory_order_acquire) == old &&
+           std::chrono::steady_clock::now() < deadline) {
+        backoff();
+    }
+#endif
+}
+
+/**
+ * @brief Wakes up to `count` threads blocked by `dsa::futex_wait()` or
+ *      `dsa::futex_wait_for()` on `word`.
+ *
+ * @param word The word that threads wait on, which the caller must have
+ *      changed beforehand.
+ * @param count The maximum number of threads to wake.
+ */
+inline void futex_wake(std::atomic<std::uint32_t>& word, int count) noexcept {
+#if defined(__linux__)
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+              FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+#else
+    if (count == 1) word.notify_one();
+    else word.notify_all();
+#endif
+}
+
+}   // namespace dsa
+
+#endif /* QUEUE_CONCURRENCY_HPP */
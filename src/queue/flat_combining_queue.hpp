@@ -0,0 +1,247 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      flat_combining_queue.hpp
+ * @brief     Flat-Combining Queue
+ * @details   Thread-safe generic queue that applies the operations of
+ *            contending threads in batches to a wrapped implementation of the
+ *            Queue ADT, after Hendler, Incze, Shavit and Tzafrir.
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef FLAT_COMBINING_QUEUE_HPP
+#define FLAT_COMBINING_QUEUE_HPP
+
+#include <atomic>      // atomic<T>
+#include <concepts>    // constructible_from<T, Args...>
+#include <cstddef>     // size_t
+#include <cstdint>     // uint32_t
+#include <exception>   // exception_ptr
+#include <memory>      // unique_ptr<T[]>
+#include <mutex>       // mutex
+#include <thread>      // thread::hardware_concurrency()
+
+#include "adt.hpp"                // IQueue<Elem, Impl>
+#include "circ_array_queue.hpp"   // CircArrayQueue<Elem>
+#include "concurrency.hpp"        // cache_line_size, Backoff, ...
+
+namespace dsa
+{
+
+/**
+ * @brief Flat-combining queue.
+ *
+ * A generic queue type that implements the Queue ADT `dsa::IQueue` by
+ * wrapping any implementation of it that is not thread-safe, and lets any
+ * number of threads access it. This class template statically inherits the
+ * Queue ADT template class using the Curiously Recurring Template Pattern
+ * (CRTP).
+ *
+ * Rather than taking a lock around every operation, a thread publishes its
+ * operation in a publication slot, and then either takes the lock, if it is
+ * free, or waits for its operation to be applied. The thread that holds the
+ * lock, the combiner, applies the pending operations of all slots in one
+ * batch. The wrapped queue thus stays in the combiner's cache for the whole
+ * batch, and the other threads only touch their own slots and the lock,
+ * which makes contention far cheaper than with a lock alone.
+ *
+ * A thread is mapped onto a slot by its index `dsa::this_thread_index()`. If
+ * another thread is using that slot, the thread takes the lock and applies its
+ * operation itself, combining the pending operations of others as well.
+ *
+ * @tparam Elem The queue element type.
+ * @tparam Queue The queue to wrap. Defaults to `dsa::CircArrayQueue<Elem>`.
+ * @note An exception thrown by an operation applied by the combiner is
+ *      rethrown in the thread that published the operation. `front()` and
+ *      `to_string()` take the lock instead of being combined; a reference
+ *      returned by `front()` is only valid until another thread removes the
+ *      element.
+ */
+template <typename Elem, typename Queue = CircArrayQueue<Elem>>
+class FlatCombiningQueue
+    : public IQueue<Elem, FlatCombiningQueue, FlatCombiningQueue<Elem, Queue>>
+{
+    // Parent class, which is allowed to access the private impl methods
+    friend class IQueue<Elem, FlatCombiningQueue,
+                        FlatCombiningQueue<Elem, Queue>>;
+
+public:
+    /**
+     * @brief Creates an empty queue.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the wrapped queue type `Queue`.
+     * @param num_slots Number of publication slots, which is raised to one.
+     *      Up to as many threads as there are slots can have one of their own.
+     * @param args Arguments to be passed to the constructor of the wrapped
+     *      queue type `Queue`, e.g. its initial capacity.
+     */
+    template <typename... Args>
+        requires std::constructible_from<Queue, Args...>
+    explicit FlatCombiningQueue(
+        std::size_t num_slots = std::thread::hardware_concurrency(),
+        Args&&... args);
+
+    // The slots are shared between threads, so a queue is neither copyable nor
+    // movable
+    FlatCombiningQueue(FlatCombiningQueue const&)            = delete;
+    FlatCombiningQueue& operator=(FlatCombiningQueue const&) = delete;
+
+    /**
+     * @brief Moves the element at the front of this queue out and removes it,
+     * unless the queue is empty.
+     *
+     * @param out The object to move-assign the front element to.
+     * @return `true` if an element is removed, `false` if this queue is empty.
+     */
+    bool try_dequeue(Elem& out);
+
+    /** Number of publication slots. */
+    std::size_t num_slots() const noexcept;
+
+private:
+    // Publication slot, on cache lines of its own
+    struct alignas(cache_line_size) Slot
+    {
+        // vacant --> claimed by its owner --> pending --> done --> vacant
+        std::atomic<std::uint32_t> state { vacant };
+        // Operation, type-erased, and the exception it threw, if any
+        void (*apply)(void* op, Queue& q) { nullptr };
+        void*              op { nullptr };
+        std::exception_ptr error {};
+    };
+
+    // Slot states
+    static constexpr std::uint32_t vacant { 0 };
+    static constexpr std::uint32_t claimed { 1 };
+    static constexpr std::uint32_t pending { 2 };
+    static constexpr std::uint32_t done { 3 };
+
+    // Maximum number of passes a combiner makes over the slots, as long as
+    // each pass finds pending operations
+    static constexpr std::size_t max_passes { 3 };
+
+    std::unique_ptr<Slot[]> slots_;
+    std::size_t             num_slots_;
+
+    alignas(cache_line_size) mutable std::mutex mtx_ {};
+    Queue q_;
+    // Number of elements, which is read without taking the lock
+    std::atomic<std::size_t> size_cache_ { 0 };
+
+    // Applies an operation, which takes the wrapped queue, through a slot, or
+    // directly if the slot of the calling thread is in use.
+    template <typename Op>
+    void combine_(Op&& op);
+    // Applies the pending operations of all slots (lock held).
+    void combine_pending_() noexcept;
+
+    /** Number of elements in the queue. */
+    std::size_t size_() const noexcept;
+
+    /** Determines if this queue has no elements. */
+    bool empty_() const noexcept;
+
+    /**
+     * @brief Iterates over all elements of this queue from the front.
+     *
+     * The given operation will be performed on each element iterated, with
+     * the lock held.
+     *
+     * @param action The operation to be performed on each element.
+     */
+    void iter_(std::function<void(Elem const&)> action) const;
+
+    /**
+     * @brief Accesses the element at the front of this queue.
+     *
+     * @returns The front element.
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem& front_();
+
+    /**
+     * @brief Accesses (read-only) the element at the front of this queue.
+     *
+     * @returns The front element (immutable).
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem const& front_() const;
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elem The element to be added.
+     */
+    void enqueue_(Elem const& elem);
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * The element will be put into the queue using move semantics.
+     *
+     * @param elem The element to be added.
+     */
+    void enqueue_(Elem&& elem);
+
+    /**
+     * @brief Removes the element at end of this queue.
+     *
+     * @throws dsa::EmptyQueueError if this queue is empty.
+     */
+    void dequeue_();
+
+    /**
+     * @brief Creates a new element in-place after the last element of this
+     * queue.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     */
+    template <typename... Args>
+    void emplace_(Args&&... args);
+};
+
+}   // namespace dsa
+
+#include "flat_combining_queue.inl"
+
+#endif /* FLAT_COMBINING_QUEUE_HPP */
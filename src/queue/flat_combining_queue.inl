@@ -0,0 +1,189 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "flat_combining_queue.hpp"
+
+#include <algorithm>     // max()
+#include <type_traits>   // remove_reference_t<T>
+#include <utility>       // move(), forward(), exchange()
+
+namespace dsa
+{
+
+// === PUBLIC METHODS ===
+
+// clang-format off
+template <typename Elem, typename Queue>
+template <typename... Args>
+    requires std::constructible_from<Queue, Args...>
+FlatCombiningQueue<Elem, Queue>::FlatCombiningQueue(std::size_t num_slots,
+                                                    Args&&... args)
+    : num_slots_ { std::max(num_slots, std::size_t { 1 }) }
+    , q_(std::forward<Args>(args)...) {
+    slots_ = std::make_unique<Slot[]>(num_slots_);
+    size_cache_.store(q_.size(), std::memory_order_relaxed);
+}
+// clang-format on
+
+template <typename Elem, typename Queue>
+bool FlatCombiningQueue<Elem, Queue>::try_dequeue(Elem& out) {
+    auto dequeued = false;
+    combine_([&out, &dequeued](Queue& q) {
+        if (q.empty()) return;
+        out = std::move(q.front());
+        q.dequeue();
+        dequeued = true;
+    });
+    return dequeued;
+}
+
+template <typename Elem, typename Queue>
+std::size_t FlatCombiningQueue<Elem, Queue>::num_slots() const noexcept {
+    return num_slots_;
+}
+
+// === PRIVATE METHODS ===
+
+template <typename Elem, typename Queue>
+template <typename Op>
+void FlatCombiningQueue<Elem, Queue>::combine_(Op&& op) {
+    auto& slot     = slots_[this_thread_index() % num_slots_];
+    auto  expected = vacant;
+    if (!slot.state.compare_exchange_strong(expected, claimed,
+                                            std::memory_order_acquire,
+                                            std::memory_order_relaxed)) {
+        // Slot shared with another thread, which is using it
+        auto lock = std::scoped_lock { mtx_ };
+        combine_pending_();
+        op(q_);
+        size_cache_.store(q_.size(), std::memory_order_relaxed);
+        return;
+    }
+
+    slot.apply = [](void* op_, Queue& q) {
+        (*static_cast<std::remove_reference_t<Op>*>(op_))(q);
+    };
+    slot.op = &op;
+    // Release, so that the combiner sees the operation
+    slot.state.store(pending, std::memory_order_release);
+
+    // Acquire, so that the effects of the operation are seen
+    auto backoff = Backoff<> {};
+    while (slot.state.load(std::memory_order_acquire) != done) {
+        if (mtx_.try_lock()) {
+            // The pending operation of this thread is applied too
+            combine_pending_();
+            mtx_.unlock();
+        } else {
+            backoff();
+        }
+    }
+
+    auto error = std::exchange(slot.error, nullptr);
+    slot.state.store(vacant, std::memory_order_release);
+    if (error) std::rethrow_exception(error);
+}
+
+template <typename Elem, typename Queue>
+void FlatCombiningQueue<Elem, Queue>::combine_pending_() noexcept {
+    for (std::size_t pass { 0 }; pass < max_passes; ++pass) {
+        std::size_t num_applied { 0 };
+        for (std::size_t i { 0 }; i < num_slots_; ++i) {
+            auto& slot = slots_[i];
+            if (slot.state.load(std::memory_order_acquire) != pending) continue;
+            try {
+                slot.apply(slot.op, q_);
+            }
+            catch (...) {
+                slot.error = std::current_exception();
+            }
+            // Release, so that the owner sees the effects of the operation
+            slot.state.store(done, std::memory_order_release);
+            ++num_applied;
+        }
+        if (num_applied == 0) break;
+    }
+    size_cache_.store(q_.size(), std::memory_order_relaxed);
+}
+
+template <typename Elem, typename Queue>
+std::size_t FlatCombiningQueue<Elem, Queue>::size_() const noexcept {
+    return size_cache_.load(std::memory_order_relaxed);
+}
+
+template <typename Elem, typename Queue>
+bool FlatCombiningQueue<Elem, Queue>::empty_() const noexcept {
+    return size_() == 0;
+}
+
+template <typename Elem, typename Queue>
+void FlatCombiningQueue<Elem, Queue>::iter_(
+    std::function<void(Elem const&)> action) const {
+    auto lock = std::scoped_lock { mtx_ };
+    q_.iter(action);
+}
+
+template <typename Elem, typename Queue>
+Elem& FlatCombiningQueue<Elem, Queue>::front_() {
+    return const_cast<Elem&>(
+        const_cast<const FlatCombiningQueue<Elem, Queue>*>(this)->front_());
+}
+
+template <typename Elem, typename Queue>
+Elem const& FlatCombiningQueue<Elem, Queue>::front_() const {
+    auto lock = std::scoped_lock { mtx_ };
+    return q_.front();
+}
+
+template <typename Elem, typename Queue>
+void FlatCombiningQueue<Elem, Queue>::enqueue_(Elem const& elem) {
+    combine_([&elem](Queue& q) { q.enqueue(elem); });
+}
+
+template <typename Elem, typename Queue>
+void FlatCombiningQueue<Elem, Queue>::enqueue_(Elem&& elem) {
+    combine_([&elem](Queue& q) { q.enqueue(std::move(elem)); });
+}
+
+template <typename Elem, typename Queue>
+void FlatCombiningQueue<Elem, Queue>::dequeue_() {
+    combine_([](Queue& q) { q.dequeue(); });
+}
+
+template <typename Elem, typename Queue>
+template <typename... Args>
+void FlatCombiningQueue<Elem, Queue>::emplace_(Args&&... args) {
+    combine_([&args...](Queue& q) { q.emplace(std::forward<Args>(args)...); });
+}
+
+}   // namespace dsa
@@ -0,0 +1,249 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      hazard_pointer.hpp
+ * @brief     Hazard Pointers
+ * @details   Safe memory reclamation for the lock-free implementations of the
+ *            Queue ADT, after Maged Michael's hazard pointers.
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef QUEUE_HAZARD_POINTER_HPP
+#define QUEUE_HAZARD_POINTER_HPP
+
+#include <atomic>    // atomic<T>
+#include <cstddef>   // size_t
+#include <mutex>     // mutex
+#include <new>       // nothrow_t
+#include <vector>    // vector<T>
+
+#include "concurrency.hpp"   // cache_line_size
+
+namespace dsa
+{
+
+/**
+ * @brief Hazard pointer domain.
+ *
+ * Keeps track of the objects that threads are about to access, and of the
+ * objects retired, i.e. removed from a concurrent data structure, that are
+ * yet to be reclaimed. A retired object is reclaimed only once no hazard
+ * pointer protects it, so a thread never accesses an object freed by another
+ * thread, and an object cannot be freed and reallocated at the same address
+ * under a thread that compares pointers (ABA).
+ *
+ * There is a single, global domain, which is used through
+ * `dsa::HazardPointer`, `dsa::retire()` and `dsa::reclaim_retired()`.
+ *
+ * @note Each thread collects the objects it retires and reclaims them in a
+ *      batch once there are enough of them to amortize the cost of scanning
+ *      all hazard pointers. The objects a thread leaves behind when it exits
+ *      are handed over to the next thread that reclaims, or to the domain
+ *      itself when the program exits.
+ */
+class HazardDomain
+{
+    friend class HazardPointer;
+    friend void retire(void* ptr, void (*reclaim)(void*)) noexcept;
+    friend void reclaim_retired();
+
+public:
+    /** Gets the global domain. */
+    static HazardDomain& global() noexcept;
+
+    ~HazardDomain();
+
+private:
+    // Hazard pointer slot, which is reused by other threads once released
+    struct alignas(cache_line_size) Slot
+    {
+        std::atomic<void const*> ptr { nullptr };
+        std::atomic<bool>        in_use { true };
+        Slot*                    next { nullptr };
+    };
+
+    // Object retired, along with the operation to reclaim it
+    struct Retired
+    {
+        void* ptr;
+        void (*reclaim)(void*);
+    };
+
+    // Slots and retired objects owned by a thread
+    struct ThreadState
+    {
+        std::vector<Slot*>   free_slots {};
+        std::vector<Retired> retired {};
+
+        ~ThreadState();
+    };
+
+    // Maximum number of released slots a thread keeps for reuse
+    static constexpr std::size_t max_free_slots { 8 };
+    // Minimum number of retired objects a thread collects before reclaiming
+    static constexpr std::size_t min_batch_size { 64 };
+
+    // All slots ever allocated, most recent first
+    std::atomic<Slot*>       slots_ { nullptr };
+    std::atomic<std::size_t> num_slots_ { 0 };
+    // Objects retired by threads that have exited
+    std::mutex               orphans_mtx_ {};
+    std::vector<Retired>     orphans_ {};
+
+    HazardDomain() = default;
+
+    // Gets the state of the calling thread.
+    static ThreadState& local_();
+    // Gets a slot not in use, preferably one released by the calling thread.
+    Slot*               acquire_();
+    // Gets a slot like acquire_(), or nullptr if one cannot be allocated.
+    Slot*               try_acquire_() noexcept;
+    // Releases a slot to the calling thread, or to all threads if the calling
+    // thread keeps enough released slots already.
+    void                release_(Slot* slot) noexcept;
+    // Retires an object, and reclaims the batch of objects retired by the
+    // calling thread if the batch is large enough.
+    void                retire_(Retired retired) noexcept;
+    // Reclaims the objects in `retired` that are not protected, and keeps the
+    // others.
+    void                scan_(std::vector<Retired>& retired);
+    // Same as scan_(), but slower, as it allocates no memory, and leaves out
+    // the objects retired by threads that have exited.
+    void                scan_in_place_(std::vector<Retired>& retired) noexcept;
+    // Determines if any hazard pointer protects the object at `ptr`.
+    bool                is_protected_(void const* ptr) const noexcept;
+    // Waits until no hazard pointer protects the object at `ptr`.
+    void                wait_unprotected_(void const* ptr) const noexcept;
+};
+
+/**
+ * @brief Hazard pointer.
+ *
+ * Protects an object from being reclaimed while the owning thread accesses it:
+ * an object retired by any thread is not reclaimed as long as a hazard pointer
+ * protects it. A hazard pointer protects at most one object at a time, and is
+ * owned by the thread that created it.
+ *
+ * @note A hazard pointer takes a slot from the global `dsa::HazardDomain` when
+ *      it is created and gives the slot back when it is destroyed. Released
+ *      slots are kept by the thread for reuse, so creating a hazard pointer is
+ *      cheap.
+ */
+class HazardPointer
+{
+    HazardDomain::Slot* slot_;
+
+public:
+    /**
+     * @brief Creates a hazard pointer that protects no object.
+     *
+     * @throws std::bad_alloc if a slot cannot be allocated.
+     */
+    HazardPointer();
+    /**
+     * @brief Creates a hazard pointer that protects no object, or an empty
+     * hazard pointer if a slot cannot be allocated.
+     *
+     * An empty hazard pointer cannot protect any object, so the caller must
+     * check it before calling `protect()`, e.g. to fall back to an answer
+     * that needs no object to be accessed.
+     */
+    explicit HazardPointer(std::nothrow_t) noexcept;
+    /** Destroys this hazard pointer, which stops protecting any object. */
+    ~HazardPointer();
+
+    HazardPointer(HazardPointer const&)            = delete;
+    HazardPointer& operator=(HazardPointer const&) = delete;
+
+    /**
+     * @brief Protects the object pointed to by an atomic pointer.
+     *
+     * The pointer is loaded until it points to the object protected, so that
+     * the object was not retired before it became protected.
+     *
+     * @tparam T Type of the object.
+     * @param src The atomic pointer to the object.
+     * @return Pointer to the object protected, which can be accessed safely
+     *      until this hazard pointer protects another object or is reset.
+     * @note The object may not be retired before it is unlinked, i.e. no
+     *      longer reachable through `src`.
+     */
+    template <typename T>
+    T* protect(std::atomic<T*> const& src) noexcept;
+
+    /** Stops protecting any object. */
+    void reset() noexcept;
+
+    /** Determines if this hazard pointer has a slot, i.e. is not empty. */
+    explicit operator bool() const noexcept;
+};
+
+/**
+ * @brief Retires an object, which will be reclaimed once no hazard pointer
+ *      protects it.
+ *
+ * @param ptr Pointer to the object, which must not be reachable by any thread
+ *      that is not already protecting it.
+ * @param reclaim The operation that reclaims the object, which must not throw.
+ * @note Should memory run out, objects are reclaimed without allocating, and
+ *      as a last resort the object is reclaimed as soon as no hazard pointer
+ *      protects it, waiting until then, so a thread that may run out of memory
+ *      should not protect an object it retires.
+ */
+void retire(void* ptr, void (*reclaim)(void*)) noexcept;
+
+/**
+ * @brief Retires an object on the free store, which will be deleted once no
+ *      hazard pointer protects it.
+ *
+ * @tparam T Type of the object.
+ * @param ptr Pointer to the object, which must not be reachable by any thread
+ *      that is not already protecting it.
+ */
+template <typename T>
+void retire(T* ptr) noexcept;
+
+/**
+ * @brief Reclaims the objects retired by the calling thread that no hazard
+ *      pointer protects, without waiting for a batch to fill up.
+ */
+void reclaim_retired();
+
+}   // namespace dsa
+
+#include "hazard_pointer.inl"
+
+#endif /* QUEUE_HAZARD_POINTER_HPP */
@@ -0,0 +1,283 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "hazard_pointer.hpp"
+
+#include <algorithm>   // max(), sort(), binary_search(), partition()
+#include <new>         // nothrow, bad_alloc
+#include <thread>      // this_thread::yield()
+#include <utility>     // exchange()
+
+namespace dsa
+{
+
+// === HAZARD DOMAIN ===
+
+inline HazardDomain& HazardDomain::global() noexcept {
+    static auto domain = HazardDomain {};
+    return domain;
+}
+
+inline HazardDomain::~HazardDomain() {
+    // No thread is left to protect any object
+    for (auto const& retired : orphans_) retired.reclaim(retired.ptr);
+    for (auto* slot = slots_.load(); slot;) {
+        delete std::exchange(slot, slot->next);
+    }
+}
+
+inline HazardDomain::ThreadState::~ThreadState() {
+    auto& domain = HazardDomain::global();
+    for (auto* slot : free_slots) {
+        slot->in_use.store(false, std::memory_order_release);
+    }
+    try {
+        domain.scan_(retired);
+    }
+    catch (std::bad_alloc const&) {
+        domain.scan_in_place_(retired);
+    }
+    try {
+        auto lock = std::scoped_lock { domain.orphans_mtx_ };
+        domain.orphans_.insert(domain.orphans_.end(), retired.begin(),
+                               retired.end());
+    }
+    catch (...) {
+        // The objects cannot be handed over, so they are reclaimed as soon as
+        // no other thread protects them
+        for (auto const& r : retired) {
+            domain.wait_unprotected_(r.ptr);
+            r.reclaim(r.ptr);
+        }
+    }
+}
+
+inline HazardDomain::ThreadState& HazardDomain::local_() {
+    thread_local auto state = ThreadState {};
+    return state;
+}
+
+inline HazardDomain::Slot* HazardDomain::acquire_() {
+    auto* const slot = try_acquire_();
+    if (!slot) throw std::bad_alloc {};
+    return slot;
+}
+
+inline HazardDomain::Slot* HazardDomain::try_acquire_() noexcept {
+    // The state of a thread allocates nothing until a slot is released
+    auto& free_slots = local_().free_slots;
+    if (!free_slots.empty()) {
+        auto* const slot = free_slots.back();
+        free_slots.pop_back();
+        return slot;
+    }
+
+    // Take over a slot released by another thread
+    for (auto* slot = slots_.load(std::memory_order_acquire); slot;
+         slot       = slot->next) {
+        auto in_use = false;
+        if (slot->in_use.compare_exchange_strong(in_use, true,
+                                                 std::memory_order_acquire)) {
+            return slot;
+        }
+    }
+
+    auto* const slot = new (std::nothrow) Slot {};
+    if (!slot) return nullptr;
+    slot->next = slots_.load(std::memory_order_relaxed);
+    while (!slots_.compare_exchange_weak(slot->next, slot,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed)) {}
+    num_slots_.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+inline void HazardDomain::release_(Slot* slot) noexcept {
+    slot->ptr.store(nullptr, std::memory_order_release);
+    auto& free_slots = local_().free_slots;
+    // Never reallocates, as the capacity is reserved on first use, or else
+    // the slot is released to all threads
+    if (free_slots.capacity() == 0) {
+        try {
+            free_slots.reserve(max_free_slots);
+        }
+        catch (std::bad_alloc const&) {}
+    }
+    if (free_slots.size() < max_free_slots &&
+        free_slots.size() < free_slots.capacity()) {
+        free_slots.push_back(slot);
+        return;
+    }
+    slot->in_use.store(false, std::memory_order_release);
+}
+
+inline void HazardDomain::retire_(Retired retired) noexcept {
+    auto& batch = local_().retired;
+    if (batch.size() == batch.capacity()) {
+        // Make room ahead of time, or else by reclaiming in place
+        try {
+            batch.reserve(std::max(min_batch_size, 2 * batch.capacity()));
+        }
+        catch (std::bad_alloc const&) {
+            scan_in_place_(batch);
+        }
+    }
+    if (batch.size() == batch.capacity()) {
+        // Out of memory, with every object in the batch protected
+        wait_unprotected_(retired.ptr);
+        retired.reclaim(retired.ptr);
+        return;
+    }
+    batch.push_back(retired);   // never reallocates
+
+    auto const num_slots = num_slots_.load(std::memory_order_relaxed);
+    // Reclaims a constant fraction of the batch at least, as at most
+    // `num_slots` objects are protected
+    if (batch.size() >= std::max(min_batch_size, 2 * num_slots)) {
+        try {
+            scan_(batch);
+        }
+        catch (std::bad_alloc const&) {
+            scan_in_place_(batch);
+        }
+    }
+}
+
+inline void HazardDomain::scan_(std::vector<Retired>& retired) {
+    {
+        auto lock = std::scoped_lock { orphans_mtx_ };
+        retired.insert(retired.end(), orphans_.begin(), orphans_.end());
+        orphans_.clear();
+    }
+
+    // Pairs with the protecting thread storing its hazard pointer before
+    // checking that the object is still reachable: either that thread sees
+    // the object unlinked, or this thread sees the hazard pointer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto hazards = std::vector<void const*> {};
+    for (auto* slot = slots_.load(std::memory_order_acquire); slot;
+         slot       = slot->next) {
+        if (auto const* ptr = slot->ptr.load(std::memory_order_seq_cst)) {
+            hazards.push_back(ptr);
+        }
+    }
+    std::sort(hazards.begin(), hazards.end());
+
+    auto const first_unprotected =
+        std::partition(retired.begin(), retired.end(), [&](auto const& r) {
+            return std::binary_search(hazards.begin(), hazards.end(), r.ptr);
+        });
+    // Taken out first, in case reclaiming an object retires another
+    auto unprotected = std::vector<Retired>(first_unprotected, retired.end());
+    retired.erase(first_unprotected, retired.end());
+    for (auto const& r : unprotected) r.reclaim(r.ptr);
+}
+
+inline void
+    HazardDomain::scan_in_place_(std::vector<Retired>& retired) noexcept {
+    std::atomic_thread_fence(std::memory_order_seq_cst);   // as in scan_()
+    for (std::size_t i { 0 }; i < retired.size();) {
+        if (is_protected_(retired[i].ptr)) {
+            ++i;
+            continue;
+        }
+        // Taken out first, in case reclaiming the object retires another
+        auto const r = retired[i];
+        retired[i]   = retired.back();
+        retired.pop_back();
+        r.reclaim(r.ptr);
+    }
+}
+
+inline bool HazardDomain::is_protected_(void const* ptr) const noexcept {
+    for (auto* slot = slots_.load(std::memory_order_acquire); slot;
+         slot       = slot->next) {
+        if (slot->ptr.load(std::memory_order_seq_cst) == ptr) return true;
+    }
+    return false;
+}
+
+inline void HazardDomain::wait_unprotected_(void const* ptr) const noexcept {
+    std::atomic_thread_fence(std::memory_order_seq_cst);   // as in scan_()
+    while (is_protected_(ptr)) std::this_thread::yield();
+}
+
+// === HAZARD POINTER ===
+
+inline HazardPointer::HazardPointer()
+    : slot_ { HazardDomain::global().acquire_() } {}
+
+inline HazardPointer::HazardPointer(std::nothrow_t) noexcept
+    : slot_ { HazardDomain::global().try_acquire_() } {}
+
+inline HazardPointer::~HazardPointer() {
+    if (slot_) HazardDomain::global().release_(slot_);
+}
+
+template <typename T>
+T* HazardPointer::protect(std::atomic<T*> const& src) noexcept {
+    auto* ptr = src.load(std::memory_order_relaxed);
+    while (true) {
+        // Sequentially consistent, so that the store is visible to any thread
+        // that unlinks the object after the reload below
+        slot_->ptr.store(ptr, std::memory_order_seq_cst);
+        auto* const reloaded = src.load(std::memory_order_seq_cst);
+        if (reloaded == ptr) return ptr;
+        ptr = reloaded;
+    }
+}
+
+inline void HazardPointer::reset() noexcept {
+    slot_->ptr.store(nullptr, std::memory_order_release);
+}
+
+inline HazardPointer::operator bool() const noexcept {
+    return slot_ != nullptr;
+}
+
+// === RECLAMATION ===
+
+inline void retire(void* ptr, void (*reclaim)(void*)) noexcept {
+    HazardDomain::global().retire_({ ptr, reclaim });
+}
+
+template <typename T>
+void retire(T* ptr) noexcept {
+    retire(ptr, [](void* p) { delete static_cast<T*>(p); });
+}
+
+inline void reclaim_retired() {
+    HazardDomain::global().scan_(HazardDomain::local_().retired);
+}
+
+}   // namespace dsa
@@ -0,0 +1,255 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      incr_circ_array_queue.hpp
+ * @brief     Incrementally Resized Circular Array Queue
+ * @details   Unbounded generic queue -- an implementation of the Queue ADT
+ *            using a circular array with an incremental resizing scheme
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef INCR_CIRC_ARRAY_QUEUE_HPP
+#define INCR_CIRC_ARRAY_QUEUE_HPP
+
+#include <cstddef>   // size_t
+#include <cstdint>   // int8_t
+#include <memory>    // allocator<T>, construct_at(), destroy_at()
+
+#include "adt.hpp"                // IQueue<Elem, Impl>
+#include "circ_array_queue.hpp"   // CapacityMode, ResizePolicy
+
+namespace dsa
+{
+
+/**
+ * @brief Incrementally resized circular array queue.
+ *
+ * An unbounded, generic queue type that implements the Queue ADT
+ * `dsa::IQueue` using a circular array, like `dsa::CircArrayQueue`, except
+ * that resizing is amortized over subsequent operations in the style of
+ * incremental rehashing. This class template statically inherits the Queue
+ * ADT template class using the Curiously Recurring Template Pattern (CRTP).
+ *
+ * When the resizing policy determines to grow or shrink, a new array is
+ * allocated, but the elements stay in the old array. Thereafter, each enqueue
+ * and dequeue migrates at most `Step` elements from the back of the old array
+ * to the new one, while new elements are added to the new array and the front
+ * elements are removed from the old array, until the old array is drained and
+ * freed. Thus no single operation moves more than `Step` elements, at the
+ * expense of holding two arrays for a while.
+ *
+ * @tparam Elem The queue element type.
+ * @tparam Mode The capacity mode. Defaults to `dsa::ExactCapacity`.
+ * @tparam Policy The resizing policy. Defaults to `dsa::GeometricResizing<>`.
+ * @tparam Step The maximum number of elements migrated per operation while
+ *      resizing. Defaults to 4.
+ * @note The queue elements have value semantics. The migration always
+ *      completes before the new array is full, provided that the resizing
+ *      policy at least doubles the capacity; otherwise the remaining elements
+ *      are migrated at once when the new array is full.
+ */
+template <typename Elem, CapacityMode Mode = ExactCapacity,
+          ResizePolicy Policy = GeometricResizing<>, std::size_t Step = 4>
+class IncrCircArrayQueue
+    : public IQueue<Elem, IncrCircArrayQueue,
+                    IncrCircArrayQueue<Elem, Mode, Policy, Step>>
+{
+    static_assert(Step > 0, "migration step must be positive");
+
+    // Parent class, which is allowed to access the private impl methods
+    friend class IQueue<Elem, IncrCircArrayQueue,
+                        IncrCircArrayQueue<Elem, Mode, Policy, Step>>;
+
+public:
+    /**
+     * @brief Creates an empty queue.
+     *
+     * @param init_cap The initially anticipated maximum number of elements to
+     *      be stored in the queue.
+     * @note Memory will be allocated according to `init_cap` and the element
+     *      type `Elem`, after `init_cap` is raised to the minimum capacity of
+     *      the resizing policy and fitted by the capacity mode. No element is
+     *      constructed until one is enqueued.
+     */
+    IncrCircArrayQueue(std::size_t init_cap = 4096);
+    ~IncrCircArrayQueue();
+
+    /** Copy-constructs a new queue from an existing queue. */
+    IncrCircArrayQueue(IncrCircArrayQueue const&);
+    /** Move-constructs a new queue from an existing queue. */
+    IncrCircArrayQueue(IncrCircArrayQueue&&) noexcept;
+
+    /** Copy-assigns an existing queue to this queue. */
+    IncrCircArrayQueue& operator=(IncrCircArrayQueue const&);
+    /** Move-assigns an existing queue to this queue. */
+    IncrCircArrayQueue& operator=(IncrCircArrayQueue&&) noexcept;
+
+    /**
+     * @brief Maximum number of elements this queue can store without allocating
+     * additional memory.
+     *
+     * @return The maximum number, which is the capacity of the new array while
+     *      resizing.
+     */
+    std::size_t capacity() const noexcept;
+
+    /** Determines if this queue is migrating elements to a new array. */
+    bool resizing() const noexcept;
+
+private:
+    // Array holding the back elements (all elements unless resizing)
+    Elem*       elems_ { nullptr };   // uninitialized unless occupied
+    std::size_t capacity_;
+    std::size_t start_idx_ { 0 };
+    std::size_t num_elems_ { 0 };
+
+    // Array holding the front elements while resizing, nullptr otherwise
+    Elem*       old_elems_ { nullptr };
+    std::size_t old_capacity_ { 0 };
+    std::size_t old_start_idx_ { 0 };
+    std::size_t old_num_elems_ { 0 };
+
+    // Destroys all elements and frees both arrays.
+    void        release_() noexcept;
+    // Gets the element at position `i` from the front of this queue.
+    Elem const& at_(std::size_t i) const noexcept;
+
+    // Starts, continues or finishes the migration of the elements as the
+    // resizing policy determines. Take 1 to grow, -1 to shrink by convention.
+    void        resize_(std::int8_t factor);
+    // Allocates a new array of capacity `new_cap`, and reserves slots at its
+    // start for the elements of the current array, which becomes the old one.
+    void        begin_migration_(std::size_t new_cap);
+    // Migrates at most `n` elements from the back of the old array, and
+    // frees the old array once it is drained.
+    void        migrate_(std::size_t n);
+
+    /** Number of elements in the queue. */
+    std::size_t size_() const noexcept;
+
+    /** Determines if this queue has no elements. */
+    bool empty_() const noexcept;
+
+    /**
+     * @brief Iterates over all elements of this queue from the front.
+     *
+     * The given operation will be performed on each element iterated.
+     *
+     * @param action The operation to be performed on each element.
+     */
+    void iter_(std::function<void(Elem const&)> action) const;
+
+    /**
+     * @brief Accesses the element at the front of this queue.
+     *
+     * @returns The front element.
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem& front_();
+
+    /**
+     * @brief Accesses (read-only) the element at the front of this queue.
+     *
+     * @returns The front element (immutable).
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem const& front_() const;
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elem The element to be added.
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`.
+     * @note A new array will be allocated prior to this operation if the
+     *      number of elements of this queue exceeds the current capacity, and
+     *      at most `Step` elements are migrated to it.
+     */
+    void enqueue_(Elem const& elem);
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * The element will be put into the queue using move semantics.
+     *
+     * @param elem The element to be added.
+     * @throws std::bad_alloc or any exception thrown by the constuctor
+     * of type `Elem`.
+     * @note A new array will be allocated prior to this operation if the
+     *      number of elements of this queue exceeds the current capacity, and
+     *      at most `Step` elements are migrated to it.
+     */
+    void enqueue_(Elem&& elem);
+
+    /**
+     * @brief Removes the element at end of this queue.
+     *
+     * @throws dsa::EmptyQueueError if this queue is empty.
+     * @note The removed element is destroyed immediately. A smaller array will
+     *      be allocated after this operation if the resizing policy determines
+     *      to shrink, and at most `Step` elements are migrated to it.
+     */
+    void dequeue_();
+
+    /**
+     * @brief Creates a new element in-place after the last element of this
+     * queue.
+     *
+     * The new element is constructed in-place, directly in its array slot,
+     * using all of the arguments passed to this member function.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`.
+     * @note A new array will be allocated prior to this operation if the
+     *      number of elements of this queue exceeds the current capacity, and
+     *      at most `Step` elements are migrated to it.
+     */
+    template <typename... Args>
+    void emplace_(Args&&... args);
+};
+
+}   // namespace dsa
+
+#include "incr_circ_array_queue.inl"
+
+#endif /* INCR_CIRC_ARRAY_QUEUE_HPP */
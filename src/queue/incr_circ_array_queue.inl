@@ -0,0 +1,323 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "incr_circ_array_queue.hpp"
+
+#include <algorithm>   // max()
+#include <utility>     // move_if_noexcept()
+
+namespace dsa
+{
+
+// === PUBLIC METHODS ===
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+IncrCircArrayQueue<Elem, Mode, Policy, Step>::IncrCircArrayQueue(
+    std::size_t init_cap)
+    : capacity_ { Mode::fit(std::max(init_cap, Policy::min_capacity)) } {
+    if (capacity_ > 0) elems_ = std::allocator<Elem> {}.allocate(capacity_);
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+IncrCircArrayQueue<Elem, Mode, Policy, Step>::~IncrCircArrayQueue() {
+    release_();
+}
+
+// clang-format off
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+IncrCircArrayQueue<Elem, Mode, Policy, Step>::IncrCircArrayQueue(
+    IncrCircArrayQueue const& other)
+    : capacity_ { other.capacity_ }
+{
+    // Elements are laid out from the start of a single array in the copy
+    if (capacity_ > 0) elems_ = std::allocator<Elem> {}.allocate(capacity_);
+    try {
+        for (; num_elems_ < other.size_(); ++num_elems_) {
+            std::construct_at(elems_ + num_elems_, other.at_(num_elems_));
+        }
+    }
+    catch (...) {
+        release_();
+        throw;
+    }
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+IncrCircArrayQueue<Elem, Mode, Policy, Step>::IncrCircArrayQueue(
+    IncrCircArrayQueue&& other) noexcept
+    : elems_ { other.elems_ },
+      capacity_ { other.capacity_ },
+      start_idx_ { other.start_idx_ },
+      num_elems_ { other.num_elems_ },
+      old_elems_ { other.old_elems_ },
+      old_capacity_ { other.old_capacity_ },
+      old_start_idx_ { other.old_start_idx_ },
+      old_num_elems_ { other.old_num_elems_ }
+{
+    other.elems_ = nullptr;
+    other.capacity_ = 0;
+    other.start_idx_ = 0;
+    other.num_elems_ = 0;
+    other.old_elems_ = nullptr;
+    other.old_num_elems_ = 0;
+}
+
+// clang-format on
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+IncrCircArrayQueue<Elem, Mode, Policy, Step>&
+    IncrCircArrayQueue<Elem, Mode, Policy, Step>::operator=(
+        IncrCircArrayQueue const& other) {
+    if (this != &other) *this = IncrCircArrayQueue { other };
+    return *this;
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+IncrCircArrayQueue<Elem, Mode, Policy, Step>&
+    IncrCircArrayQueue<Elem, Mode, Policy, Step>::operator=(
+        IncrCircArrayQueue&& other) noexcept {
+    if (this == &other) return *this;
+
+    release_();
+
+    elems_               = other.elems_;
+    capacity_            = other.capacity_;
+    start_idx_           = other.start_idx_;
+    num_elems_           = other.num_elems_;
+    old_elems_           = other.old_elems_;
+    old_capacity_        = other.old_capacity_;
+    old_start_idx_       = other.old_start_idx_;
+    old_num_elems_       = other.old_num_elems_;
+
+    other.elems_         = nullptr;
+    other.capacity_      = 0;
+    other.start_idx_     = 0;
+    other.num_elems_     = 0;
+    other.old_elems_     = nullptr;
+    other.old_num_elems_ = 0;
+
+    return *this;
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+std::size_t
+    IncrCircArrayQueue<Elem, Mode, Policy, Step>::capacity() const noexcept {
+    return capacity_;
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+bool IncrCircArrayQueue<Elem, Mode, Policy, Step>::resizing() const noexcept {
+    return old_elems_ != nullptr;
+}
+
+// === PRIVATE METHODS ===
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+void IncrCircArrayQueue<Elem, Mode, Policy, Step>::release_() noexcept {
+    for (std::size_t i { 0 }; i < old_num_elems_; ++i) {
+        std::destroy_at(old_elems_ +
+                        Mode::wrap(old_start_idx_ + i, old_capacity_));
+    }
+    if (old_elems_) {
+        std::allocator<Elem> {}.deallocate(old_elems_, old_capacity_);
+    }
+    for (std::size_t i { 0 }; i < num_elems_; ++i) {
+        std::destroy_at(elems_ + Mode::wrap(start_idx_ + i, capacity_));
+    }
+    if (elems_) std::allocator<Elem> {}.deallocate(elems_, capacity_);
+    elems_         = nullptr;
+    num_elems_     = 0;
+    old_elems_     = nullptr;
+    old_num_elems_ = 0;
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+Elem const& IncrCircArrayQueue<Elem, Mode, Policy, Step>::at_(
+    std::size_t i) const noexcept {
+    if (i < old_num_elems_) {
+        return old_elems_[Mode::wrap(old_start_idx_ + i, old_capacity_)];
+    }
+    return elems_[Mode::wrap(start_idx_ + i - old_num_elems_, capacity_)];
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+void IncrCircArrayQueue<Elem, Mode, Policy, Step>::resize_(std::int8_t factor) {
+    if (old_elems_) {
+        // Finish the migration at once only if the new array is full
+        if (factor <= 0 || old_num_elems_ + num_elems_ < capacity_) {
+            migrate_(Step);
+            return;
+        }
+        migrate_(old_num_elems_);
+    }
+
+    if (factor > 0) {
+        if (num_elems_ == capacity_) {
+            begin_migration_(Mode::fit(Policy::grow(capacity_)));
+            migrate_(Step);
+        }
+    } else {
+        std::size_t new_cap { Mode::fit(
+            Policy::shrink(num_elems_, capacity_)) };
+        if (new_cap < capacity_) {
+            begin_migration_(new_cap);
+            migrate_(Step);
+        }
+    }
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+void IncrCircArrayQueue<Elem, Mode, Policy, Step>::begin_migration_(
+    std::size_t new_cap) {
+    Elem* arr { new_cap > 0 ? std::allocator<Elem> {}.allocate(new_cap)
+                            : nullptr };
+    if (num_elems_ > 0) {
+        old_elems_     = elems_;
+        old_capacity_  = capacity_;
+        old_start_idx_ = start_idx_;
+        old_num_elems_ = num_elems_;
+    } else if (elems_) {
+        std::allocator<Elem> {}.deallocate(elems_, capacity_);
+    }
+
+    // Slots before the start index are reserved for the old elements
+    elems_     = arr;
+    capacity_  = new_cap;
+    start_idx_ = old_num_elems_;
+    num_elems_ = 0;
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+void IncrCircArrayQueue<Elem, Mode, Policy, Step>::migrate_(std::size_t n) {
+    for (; n > 0 && old_num_elems_ > 0; --n) {
+        Elem* src { old_elems_ + Mode::wrap(old_start_idx_ + old_num_elems_ - 1,
+                                            old_capacity_) };
+        std::construct_at(elems_ + start_idx_ - 1, std::move_if_noexcept(*src));
+        std::destroy_at(src);
+        start_idx_     -= 1;
+        num_elems_     += 1;
+        old_num_elems_ -= 1;
+    }
+    if (old_elems_ && old_num_elems_ == 0) {
+        std::allocator<Elem> {}.deallocate(old_elems_, old_capacity_);
+        old_elems_ = nullptr;
+    }
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+std::size_t
+    IncrCircArrayQueue<Elem, Mode, Policy, Step>::size_() const noexcept {
+    return old_num_elems_ + num_elems_;
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+bool IncrCircArrayQueue<Elem, Mode, Policy, Step>::empty_() const noexcept {
+    return size_() == 0;
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+void IncrCircArrayQueue<Elem, Mode, Policy, Step>::iter_(
+    std::function<void(Elem const&)> action) const {
+    for (std::size_t i { 0 }; i < size_(); ++i) action(at_(i));
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+Elem& IncrCircArrayQueue<Elem, Mode, Policy, Step>::front_() {
+    return const_cast<Elem&>(
+        const_cast<const IncrCircArrayQueue*>(this)->front_());
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+Elem const& IncrCircArrayQueue<Elem, Mode, Policy, Step>::front_() const {
+    if (empty_()) throw EmptyQueueError {};
+    return at_(0);
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+void IncrCircArrayQueue<Elem, Mode, Policy, Step>::enqueue_(Elem const& elem) {
+    emplace_(elem);
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+void IncrCircArrayQueue<Elem, Mode, Policy, Step>::enqueue_(Elem&& elem) {
+    emplace_(std::move(elem));
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+void IncrCircArrayQueue<Elem, Mode, Policy, Step>::dequeue_() {
+    if (empty_()) throw EmptyQueueError { "dequeue from empty queue" };
+    if (old_num_elems_ > 0) {
+        std::destroy_at(old_elems_ + old_start_idx_);
+        old_start_idx_ = Mode::wrap(old_start_idx_ + 1, old_capacity_);
+        old_num_elems_ -= 1;
+    } else {
+        std::destroy_at(elems_ + start_idx_);
+        start_idx_ = Mode::wrap(start_idx_ + 1, capacity_);
+        num_elems_ -= 1;
+    }
+    resize_(-1);
+}
+
+template <typename Elem, CapacityMode Mode, ResizePolicy Policy,
+          std::size_t Step>
+template <typename... Args>
+void IncrCircArrayQueue<Elem, Mode, Policy, Step>::emplace_(Args&&... args) {
+    resize_(1);
+    std::construct_at(elems_ + Mode::wrap(start_idx_ + num_elems_, capacity_),
+                      std::forward<Args>(args)...);
+    num_elems_ += 1;
+}
+
+}   // namespace dsa
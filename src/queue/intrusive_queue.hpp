@@ -0,0 +1,226 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      intrusive_queue.hpp
+ * @brief     Intrusive Queue
+ * @details   Unbounded queue of caller-owned elements, which are linked
+ *            through a hook embedded in each element, without allocating.
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef INTRUSIVE_QUEUE_HPP
+#define INTRUSIVE_QUEUE_HPP
+
+#include <cstddef>      // size_t
+#include <functional>   // function<T>
+
+#include "adt.hpp"   // EmptyQueueError
+
+namespace dsa
+{
+
+/**
+ * @brief Link of an element of an intrusive queue.
+ *
+ * An element type declares a data member of this type for each intrusive
+ * queue its elements may be in at the same time, and names the member as the
+ * hook of the queue, e.g. `dsa::IntrusiveQueue<Request, &Request::hook>`.
+ *
+ * @tparam T The element type.
+ * @note Copying an element does not copy its link, so that a copy of an
+ *      element in a queue is not in the queue.
+ */
+template <typename T>
+class IntrusiveQueueHook
+{
+    template <typename U, IntrusiveQueueHook<U> U::*Hook>
+    friend class IntrusiveQueue;
+
+    // Next element in the queue, or nullptr if not in a queue
+    T* next_ { nullptr };
+
+public:
+    /** Creates the link of an element not in a queue. */
+    IntrusiveQueueHook() noexcept = default;
+    /** Creates the link of a copy of an element, which is not in a queue. */
+    IntrusiveQueueHook(IntrusiveQueueHook const&) noexcept {}
+    /** Keeps the link of an element, which stays where it is. */
+    IntrusiveQueueHook& operator=(IntrusiveQueueHook const&) noexcept {
+        return *this;
+    }
+
+    /** Determines if the element is in a queue. */
+    bool linked() const noexcept { return next_ != nullptr; }
+};
+
+/**
+ * @brief Intrusive queue.
+ *
+ * An unbounded queue type of elements owned by the caller, e.g. requests
+ * allocated as they arrive, which are linked into the queue by reference
+ * instead of being copied into nodes of the queue. Each element embeds its
+ * own link, the hook, so adding or removing an element is a few pointer
+ * writes, and never allocates memory or throws.
+ *
+ * The elements are linked into a singly, circularly linked list, whose last
+ * element links back to the first, such that the queue keeps a single pointer
+ * to the last element, as `dsa::SLListQueue` does.
+ *
+ * An element must stay alive, and must not be moved, while it is in the
+ * queue, which unlinks any elements left in it when destroyed. It can be in
+ * at most one queue per hook at any time. The queue is movable but not
+ * copyable.
+ *
+ * @tparam T The element type.
+ * @tparam Hook The pointer to the data member of type
+ *      `dsa::IntrusiveQueueHook<T>` of `T` that links the elements.
+ * @note Unlike the other queues, this one does not implement the Queue ADT
+ *      `dsa::IQueue`, which has value semantics.
+ */
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+class IntrusiveQueue
+{
+public:
+    /** Queue element type. */
+    using elem_type = T;
+
+    /** Creates an empty queue. */
+    IntrusiveQueue() noexcept = default;
+    /**
+     * Destroys the queue, which unlinks any elements in it, so they must
+     * outlive the queue.
+     */
+    ~IntrusiveQueue();
+
+    IntrusiveQueue(IntrusiveQueue const&)            = delete;
+    IntrusiveQueue& operator=(IntrusiveQueue const&) = delete;
+
+    /**
+     * Move-constructs a new queue from an existing queue, which takes over
+     * its elements and leaves it empty.
+     */
+    IntrusiveQueue(IntrusiveQueue&& other) noexcept;
+    /**
+     * Move-assigns an existing queue to this queue, which unlinks the
+     * elements of this queue, and leaves the existing queue empty.
+     */
+    IntrusiveQueue& operator=(IntrusiveQueue&& other) noexcept;
+
+    /** Number of elements in the queue. */
+    std::size_t size() const noexcept;
+
+    /** Determines if this queue has no elements. */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Iterates over all elements of this queue from the front.
+     *
+     * The given operation will be performed on each element iterated. It's a
+     * no-op if this queue is empty.
+     *
+     * @param action The operation to be performed on each element.
+     */
+    void iter(std::function<void(T const&)> action) const;
+
+    /**
+     * @brief Accesses the element at the front of this queue.
+     *
+     * @returns The front element.
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    T& front();
+
+    /**
+     * @brief Accesses (read-only) the element at the front of this queue.
+     *
+     * @returns The front element (immutable).
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    T const& front() const;
+
+    /**
+     * @brief Links an element to the end of this queue.
+     *
+     * @param elem The element to be added, which must not be in a queue
+     *      through the same hook.
+     */
+    void enqueue(T& elem) noexcept;
+
+    /**
+     * @brief Unlinks the element at the front of this queue.
+     *
+     * @returns The removed element, which the caller owns as before.
+     * @throws dsa::EmptyQueueError if this queue is empty.
+     */
+    T& dequeue();
+
+    /**
+     * @brief Unlinks the element at the front of this queue, if any.
+     *
+     * @returns The pointer to the removed element, or `nullptr` if this queue
+     *      is empty.
+     */
+    T* try_dequeue() noexcept;
+
+    /** Unlinks all elements of this queue. */
+    void clear() noexcept;
+
+    /**
+     * @brief Links all elements of another queue to the end of this queue,
+     * leaving the other queue empty.
+     *
+     * The elements keep their order, after the elements of this queue. Only
+     * the two last elements are relinked, so it takes constant time. It's a
+     * no-op if `other` is this queue.
+     *
+     * @param other The queue whose elements are to be linked.
+     */
+    void splice(IntrusiveQueue& other) noexcept;
+
+private:
+    // Last element, whose successor is the first element, or nullptr if empty
+    T*          tail_ { nullptr };
+    std::size_t num_elems_ { 0 };
+
+    // Link to the successor of an element
+    static T*& next_(T& elem) noexcept;
+};
+
+}   // namespace dsa
+
+#include "intrusive_queue.inl"
+
+#endif /* INTRUSIVE_QUEUE_HPP */
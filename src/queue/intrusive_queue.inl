@@ -0,0 +1,159 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "intrusive_queue.hpp"
+
+#include <utility>   // exchange()
+
+namespace dsa
+{
+
+// === PUBLIC METHODS ===
+
+// clang-format off
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+IntrusiveQueue<T, Hook>::IntrusiveQueue(IntrusiveQueue&& other) noexcept
+    : tail_ { std::exchange(other.tail_, nullptr) }
+    , num_elems_ { std::exchange(other.num_elems_, 0) }
+{}
+// clang-format on
+
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+IntrusiveQueue<T, Hook>::~IntrusiveQueue() {
+    clear();
+}
+
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+IntrusiveQueue<T, Hook>&
+    IntrusiveQueue<T, Hook>::operator=(IntrusiveQueue&& other) noexcept {
+    if (this == &other) return *this;
+
+    clear();
+    tail_      = std::exchange(other.tail_, nullptr);
+    num_elems_ = std::exchange(other.num_elems_, 0);
+
+    return *this;
+}
+
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+std::size_t IntrusiveQueue<T, Hook>::size() const noexcept {
+    return num_elems_;
+}
+
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+bool IntrusiveQueue<T, Hook>::empty() const noexcept {
+    return num_elems_ == 0;
+}
+
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+void IntrusiveQueue<T, Hook>::iter(std::function<void(T const&)> action) const {
+    auto* elem = tail_;
+    for (std::size_t i { 0 }; i < num_elems_; ++i) {
+        elem = next_(*elem);
+        action(*elem);
+    }
+}
+
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+T& IntrusiveQueue<T, Hook>::front() {
+    return const_cast<T&>(static_cast<IntrusiveQueue const*>(this)->front());
+}
+
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+T const& IntrusiveQueue<T, Hook>::front() const {
+    if (num_elems_ == 0) throw EmptyQueueError {};
+
+    return *next_(*tail_);
+}
+
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+void IntrusiveQueue<T, Hook>::enqueue(T& elem) noexcept {
+    if (num_elems_ == 0) {
+        // The only element links to itself
+        next_(elem) = &elem;
+    } else {
+        next_(elem)   = next_(*tail_);
+        next_(*tail_) = &elem;
+    }
+    tail_ = &elem;
+    ++num_elems_;
+}
+
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+T& IntrusiveQueue<T, Hook>::dequeue() {
+    if (num_elems_ == 0) throw EmptyQueueError { "dequeue from empty queue" };
+
+    return *try_dequeue();
+}
+
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+T* IntrusiveQueue<T, Hook>::try_dequeue() noexcept {
+    if (num_elems_ == 0) return nullptr;
+
+    auto* head = next_(*tail_);
+    // Link the tail element to the successor of the head element, unless the
+    // head element is the only element
+    if (--num_elems_ > 0) next_(*tail_) = next_(*head);
+    else tail_ = nullptr;
+    next_(*head) = nullptr;
+    return head;
+}
+
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+void IntrusiveQueue<T, Hook>::clear() noexcept {
+    while (try_dequeue() != nullptr) {}
+}
+
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+void IntrusiveQueue<T, Hook>::splice(IntrusiveQueue& other) noexcept {
+    if (this == &other || other.num_elems_ == 0) return;
+
+    if (num_elems_ > 0) {
+        // Link the tail element to the head element of the other list, and
+        // the tail element of the other list to the head element
+        auto* head          = next_(*tail_);
+        next_(*tail_)       = next_(*other.tail_);
+        next_(*other.tail_) = head;
+    }
+    tail_       = std::exchange(other.tail_, nullptr);
+    num_elems_ += std::exchange(other.num_elems_, 0);
+}
+
+// === PRIVATE METHODS ===
+
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+T*& IntrusiveQueue<T, Hook>::next_(T& elem) noexcept {
+    return (elem.*Hook).next_;
+}
+
+}   // namespace dsa
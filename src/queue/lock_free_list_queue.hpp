@@ -0,0 +1,228 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      lock_free_list_queue.hpp
+ * @brief     Lock-Free Linked List Queue
+ * @details   Unbounded, lock-free generic queue for any number of producer and
+ *            consumer threads -- an implementation of the Queue ADT using a
+ *            singly linked list with a dummy head node.
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef LOCK_FREE_LIST_QUEUE_HPP
+#define LOCK_FREE_LIST_QUEUE_HPP
+
+#include <atomic>    // atomic<T>
+#include <cstddef>   // size_t, byte
+
+#include "adt.hpp"              // IQueue<Elem, Impl>
+#include "concurrency.hpp"      // cache_line_size
+#include "hazard_pointer.hpp"   // HazardPointer, retire()
+
+namespace dsa
+{
+
+/**
+ * @brief Lock-free linked list queue.
+ *
+ * An unbounded, generic queue type that implements the Queue ADT
+ * `dsa::IQueue` using a singly linked list with a dummy head node, after the
+ * Michael-Scott queue. Any number of threads may add and remove elements at
+ * the same time, without locking. This class template statically inherits the
+ * Queue ADT template class using the Curiously Recurring Template Pattern
+ * (CRTP).
+ *
+ * A producer links a new node after the tail node with a compare-and-swap, and
+ * a consumer unlinks the dummy head node likewise, making the node of the
+ * front element the new dummy head node. A thread that finds the tail index
+ * lagging behind the last node advances it before retrying, so no thread ever
+ * waits for another. Nodes are accessed under `dsa::HazardPointer` protection
+ * and unlinked nodes are reclaimed through `dsa::retire()`, so a node is never
+ * freed, nor its address reused, while another thread may still access it.
+ *
+ * @tparam Elem The queue element type.
+ * @note `front()`, `iter()` and `to_string()` may only be called while no
+ *      other thread removes elements. `size()` and `empty()` may be called by
+ *      any thread, but the result may be outdated by the time it is returned.
+ *      Each element is allocated in its own node, so `Elem` need not be
+ *      default constructible.
+ */
+template <typename Elem>
+class LockFreeListQueue : public IQueue<Elem, LockFreeListQueue>
+{
+    // Parent class, which is allowed to access the private impl methods
+    friend class IQueue<Elem, LockFreeListQueue>;
+
+public:
+    /**
+     * @brief Creates an empty queue.
+     *
+     * @throws std::bad_alloc if memory cannot be allocated.
+     */
+    LockFreeListQueue();
+    ~LockFreeListQueue();
+
+    // The list is shared between threads, so a queue is neither copyable nor
+    // movable
+    LockFreeListQueue(LockFreeListQueue const&)            = delete;
+    LockFreeListQueue& operator=(LockFreeListQueue const&) = delete;
+
+    /**
+     * @brief Moves the element at the front of this queue out and removes it,
+     * unless this queue is empty.
+     *
+     * @param out The object to move-assign the front element to.
+     * @return `true` if an element is removed, `false` if this queue is empty.
+     * @throws Any exception thrown by the move assignment of type `Elem`, in
+     *      which case the element is removed nonetheless.
+     */
+    bool try_dequeue(Elem& out);
+
+private:
+    // List node, which holds an element unless it is the dummy head node
+    struct Node
+    {
+        std::atomic<Node*>      next { nullptr };
+        alignas(Elem) std::byte buf[sizeof(Elem)];
+
+        Elem* elem() noexcept;
+    };
+
+    // Dummy node, whose successor holds the front element; and the number of
+    // elements removed
+    alignas(cache_line_size) std::atomic<Node*> head_;
+    std::atomic<std::size_t> num_dequeued_ { 0 };
+
+    // Last node, or a node before it while a producer is yet to advance the
+    // tail; and the number of elements added
+    alignas(cache_line_size) std::atomic<Node*> tail_;
+    std::atomic<std::size_t> num_enqueued_ { 0 };
+
+    // Links a node after the last node, using `hp` to protect the last node.
+    void  append_(Node* node, HazardPointer& hp) noexcept;
+    // Unlinks the dummy head node, unless this queue is empty, and gets its
+    // successor, which holds the front element and becomes the dummy head
+    // node. The successor stays protected by `hp_next`.
+    Node* unlink_(HazardPointer& hp_head, HazardPointer& hp_next);
+
+    /** Number of elements in the queue. */
+    std::size_t size_() const noexcept;
+
+    /** Determines if this queue has no elements. */
+    bool empty_() const noexcept;
+
+    /**
+     * @brief Iterates over all elements of this queue from the front.
+     *
+     * The given operation will be performed on each element iterated.
+     * Elements added by producers during the iteration may or may not be
+     * iterated.
+     *
+     * @param action The operation to be performed on each element.
+     */
+    void iter_(std::function<void(Elem const&)> action) const;
+
+    /**
+     * @brief Accesses the element at the front of this queue.
+     *
+     * @returns The front element.
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem& front_();
+
+    /**
+     * @brief Accesses (read-only) the element at the front of this queue.
+     *
+     * @returns The front element (immutable).
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem const& front_() const;
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elem The element to be added.
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`.
+     */
+    void enqueue_(Elem const& elem);
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * The element will be put into the queue using move semantics.
+     *
+     * @param elem The element to be added.
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`.
+     */
+    void enqueue_(Elem&& elem);
+
+    /**
+     * @brief Removes the element at end of this queue.
+     *
+     * @throws dsa::EmptyQueueError if this queue is empty.
+     * @note The removed element is destroyed immediately, while its node is
+     *      reclaimed once no other thread accesses it.
+     */
+    void dequeue_();
+
+    /**
+     * @brief Creates a new element in-place after the last element of this
+     * queue.
+     *
+     * The new element is constructed in-place, directly in a new list node,
+     * using all of the arguments passed to this member function.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`.
+     */
+    template <typename... Args>
+    void emplace_(Args&&... args);
+};
+
+}   // namespace dsa
+
+#include "lock_free_list_queue.inl"
+
+#endif /* LOCK_FREE_LIST_QUEUE_HPP */
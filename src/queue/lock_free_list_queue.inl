@@ -0,0 +1,217 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "lock_free_list_queue.hpp"
+
+#include <memory>    // construct_at(), destroy_at()
+#include <new>       // launder()
+#include <utility>   // move(), forward(), exchange()
+
+namespace dsa
+{
+
+// === PUBLIC METHODS ===
+
+template <typename Elem>
+LockFreeListQueue<Elem>::LockFreeListQueue() {
+    auto* const dummy = new Node;
+    head_.store(dummy, std::memory_order_relaxed);
+    tail_.store(dummy, std::memory_order_relaxed);
+}
+
+template <typename Elem>
+LockFreeListQueue<Elem>::~LockFreeListQueue() {
+    // No other thread is left to access any node
+    auto* node = head_.load(std::memory_order_relaxed);
+    delete std::exchange(node, node->next.load(std::memory_order_relaxed));
+    while (node) {
+        std::destroy_at(node->elem());
+        delete std::exchange(node, node->next.load(std::memory_order_relaxed));
+    }
+}
+
+template <typename Elem>
+bool LockFreeListQueue<Elem>::try_dequeue(Elem& out) {
+    HazardPointer hp_head, hp_next;
+    auto* const   node = unlink_(hp_head, hp_next);
+    if (!node) return false;
+    try {
+        out = std::move(*node->elem());
+    }
+    catch (...) {
+        std::destroy_at(node->elem());
+        throw;
+    }
+    std::destroy_at(node->elem());
+    return true;
+}
+
+// === PRIVATE METHODS ===
+
+template <typename Elem>
+Elem* LockFreeListQueue<Elem>::Node::elem() noexcept {
+    return std::launder(reinterpret_cast<Elem*>(buf));
+}
+
+template <typename Elem>
+void LockFreeListQueue<Elem>::append_(Node*          node,
+                                      HazardPointer& hp) noexcept {
+    while (true) {
+        auto* tail = hp.protect(tail_);
+        auto* next = tail->next.load(std::memory_order_acquire);
+        if (next) {
+            // The tail is lagging behind: advance it, then retry
+            tail_.compare_exchange_weak(tail, next, std::memory_order_release,
+                                        std::memory_order_relaxed);
+            continue;
+        }
+        // Release, so that the element is seen fully constructed
+        if (tail->next.compare_exchange_weak(next, node,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+            // Fails only if another thread advanced the tail already
+            tail_.compare_exchange_strong(tail, node, std::memory_order_release,
+                                          std::memory_order_relaxed);
+            num_enqueued_.fetch_add(1, std::memory_order_release);
+            return;
+        }
+    }
+}
+
+template <typename Elem>
+typename LockFreeListQueue<Elem>::Node*
+    LockFreeListQueue<Elem>::unlink_(HazardPointer& hp_head,
+                                     HazardPointer& hp_next) {
+    while (true) {
+        auto* head = hp_head.protect(head_);
+        auto* next = hp_next.protect(head->next);
+        // The successor may have been reclaimed before it was protected,
+        // unless the head node is still linked, which it then is for good as
+        // the head node is protected too
+        if (head_.load(std::memory_order_acquire) != head) continue;
+        if (!next) return nullptr;
+
+        auto* tail = tail_.load(std::memory_order_acquire);
+        if (head == tail) {
+            // The tail is lagging behind: advance it before the head node is
+            // unlinked, so that it never points to a retired node
+            tail_.compare_exchange_weak(tail, next, std::memory_order_release,
+                                        std::memory_order_relaxed);
+            continue;
+        }
+        if (head_.compare_exchange_weak(head, next, std::memory_order_acq_rel,
+                                        std::memory_order_relaxed)) {
+            num_dequeued_.fetch_add(1, std::memory_order_release);
+            // No longer accessed, nor protected, which retiring may wait for
+            // should memory run out
+            hp_head.reset();
+            retire(head);
+            return next;
+        }
+    }
+}
+
+template <typename Elem>
+std::size_t LockFreeListQueue<Elem>::size_() const noexcept {
+    // An element may be removed before the count of its producer is updated
+    auto const num_dequeued = num_dequeued_.load(std::memory_order_acquire);
+    auto const num_enqueued = num_enqueued_.load(std::memory_order_acquire);
+    return num_enqueued > num_dequeued ? num_enqueued - num_dequeued : 0;
+}
+
+template <typename Elem>
+bool LockFreeListQueue<Elem>::empty_() const noexcept {
+    // Without a slot to protect the dummy node, fall back to the counts
+    HazardPointer hp { std::nothrow };
+    if (!hp) return size_() == 0;
+    return !hp.protect(head_)->next.load(std::memory_order_acquire);
+}
+
+template <typename Elem>
+void LockFreeListQueue<Elem>::iter_(
+    std::function<void(Elem const&)> action) const {
+    auto* node = head_.load(std::memory_order_acquire);
+    while ((node = node->next.load(std::memory_order_acquire))) {
+        action(*node->elem());
+    }
+}
+
+template <typename Elem>
+Elem& LockFreeListQueue<Elem>::front_() {
+    return const_cast<Elem&>(
+        const_cast<const LockFreeListQueue<Elem>*>(this)->front_());
+}
+
+template <typename Elem>
+Elem const& LockFreeListQueue<Elem>::front_() const {
+    auto* const head = head_.load(std::memory_order_acquire);
+    auto* const next = head->next.load(std::memory_order_acquire);
+    if (!next) throw EmptyQueueError {};
+    return *next->elem();
+}
+
+template <typename Elem>
+void LockFreeListQueue<Elem>::enqueue_(Elem const& elem) {
+    emplace_(elem);
+}
+
+template <typename Elem>
+void LockFreeListQueue<Elem>::enqueue_(Elem&& elem) {
+    emplace_(std::move(elem));
+}
+
+template <typename Elem>
+void LockFreeListQueue<Elem>::dequeue_() {
+    HazardPointer hp_head, hp_next;
+    auto* const   node = unlink_(hp_head, hp_next);
+    if (!node) throw EmptyQueueError { "dequeue from empty queue" };
+    std::destroy_at(node->elem());
+}
+
+template <typename Elem>
+template <typename... Args>
+void LockFreeListQueue<Elem>::emplace_(Args&&... args) {
+    // Acquired first, so that nothing can fail once the element is created
+    HazardPointer hp;
+    auto* const   node = new Node;
+    try {
+        std::construct_at(node->elem(), std::forward<Args>(args)...);
+    }
+    catch (...) {
+        delete node;
+        throw;
+    }
+    append_(node, hp);
+}
+
+}   // namespace dsa
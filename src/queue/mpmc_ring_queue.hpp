@@ -0,0 +1,340 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      mpmc_ring_queue.hpp
+ * @brief     MPMC Ring Queue
+ * @details   Bounded, lock-free generic queue for any number of producer and
+ *            consumer threads -- an implementation of the Queue ADT using a
+ *            circular array of sequence-numbered slots
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef MPMC_RING_QUEUE_HPP
+#define MPMC_RING_QUEUE_HPP
+
+#include <atomic>        // atomic<T>
+#include <cstddef>       // size_t, byte
+#include <type_traits>   // is_nothrow_move_constructible_v<T>
+
+#include "adt.hpp"                // IQueue<Elem, Impl>
+#include "circ_array_queue.hpp"   // PowerOfTwoCapacity
+#include "concurrency.hpp"        // cache_line_size, Backoff<N>
+
+namespace dsa
+{
+
+/**
+ * @brief Multi-producer/multi-consumer ring queue.
+ *
+ * A bounded, generic queue type that implements the Queue ADT `dsa::IQueue`
+ * using a circular array whose capacity is a power of two. Any number of
+ * threads may add and remove elements at the same time, without locking. This
+ * class template statically inherits the Queue ADT template class using the
+ * Curiously Recurring Template Pattern (CRTP).
+ *
+ * Each array slot carries a sequence number, after Dmitry Vyukov's bounded
+ * MPMC queue. A producer claims the position at the tail index with a single
+ * compare-and-swap once the sequence number of its slot says the slot is free,
+ * constructs the element, then advances the sequence number to publish it.
+ * Consumers claim positions at the head index likewise. Threads contend only
+ * on the index they advance, which live on separate cache lines, and never
+ * wait for each other unless the queue is full or empty.
+ *
+ * Adding an element to a full queue fails rather than growing the queue. The
+ * non-blocking `try_enqueue()`, `try_emplace()` and `try_dequeue()` fail as
+ * soon as the queue is full or empty. `try_enqueue_spin()`,
+ * `try_emplace_spin()` and `try_dequeue_spin()` retry with exponential backoff
+ * up to a given number of times first. `enqueue()` and `emplace()` throw
+ * `dsa::FullQueueError`.
+ *
+ * @tparam Elem The queue element type, which must be nothrow move
+ *      constructible.
+ * @note `front()`, `iter()` and `to_string()` may only be called while no
+ *      other thread removes elements. `size()` and `empty()` may be called by
+ *      any thread, but the result may be outdated by the time it is returned.
+ *      An element is moved into its slot if its constructor may throw, so
+ *      that a failed construction never leaves a claimed slot unpublished.
+ */
+template <typename Elem>
+class MPMCRingQueue : public IQueue<Elem, MPMCRingQueue>
+{
+    static_assert(std::is_nothrow_move_constructible_v<Elem>,
+                  "element type must be nothrow move constructible");
+
+    // Parent class, which is allowed to access the private impl methods
+    friend class IQueue<Elem, MPMCRingQueue>;
+
+public:
+    /**
+     * @brief Creates an empty queue.
+     *
+     * @param capacity The maximum number of elements to be stored in the
+     *      queue, which is rounded up to the next power of two (at least 2).
+     * @throws std::bad_alloc if memory cannot be allocated.
+     */
+    MPMCRingQueue(std::size_t capacity = 4096);
+    ~MPMCRingQueue();
+
+    // The indices are shared between threads, so a queue is neither copyable
+    // nor movable
+    MPMCRingQueue(MPMCRingQueue const&)            = delete;
+    MPMCRingQueue& operator=(MPMCRingQueue const&) = delete;
+
+    /**
+     * @brief Maximum number of elements this queue can store.
+     *
+     * @return The maximum number.
+     */
+    std::size_t capacity() const noexcept;
+
+    /**
+     * @brief Adds an element to the end of this queue unless it is full.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elem The element to be added.
+     * @return `true` if the element is added, `false` if this queue is full.
+     * @throws Any exception thrown by the constuctor of type `Elem`.
+     */
+    bool try_enqueue(Elem const& elem);
+
+    /**
+     * @brief Adds an element to the end of this queue unless it is full.
+     *
+     * The element will be put into the queue using move semantics.
+     *
+     * @param elem The element to be added. Left intact if this queue is full.
+     * @return `true` if the element is added, `false` if this queue is full.
+     */
+    bool try_enqueue(Elem&& elem);
+
+    /**
+     * @brief Creates a new element in-place after the last element of this
+     * queue unless it is full.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     * @return `true` if the element is added, `false` if this queue is full.
+     * @throws Any exception thrown by the constuctor of type `Elem`.
+     */
+    template <typename... Args>
+    bool try_emplace(Args&&... args);
+
+    /**
+     * @brief Moves the element at the front of this queue out and removes it,
+     * unless this queue is empty.
+     *
+     * @param out The object to move-assign the front element to.
+     * @return `true` if an element is removed, `false` if this queue is empty.
+     * @throws Any exception thrown by the move assignment of type `Elem`, in
+     *      which case the element is removed nonetheless.
+     */
+    bool try_dequeue(Elem& out);
+
+    /**
+     * @brief Adds an element to the end of this queue, retrying with backoff
+     * up to `max_retries` times while it is full.
+     *
+     * @param elem The element to be added.
+     * @param max_retries The maximum number of retries.
+     * @return `true` if the element is added, `false` if this queue is still
+     *      full after the last retry.
+     * @throws Any exception thrown by the constuctor of type `Elem`.
+     */
+    bool try_enqueue_spin(Elem const& elem, std::size_t max_retries);
+
+    /**
+     * @brief Adds an element to the end of this queue, retrying with backoff
+     * up to `max_retries` times while it is full.
+     *
+     * @param elem The element to be added. Left intact if this queue is still
+     *      full after the last retry.
+     * @param max_retries The maximum number of retries.
+     * @return `true` if the element is added, `false` if this queue is still
+     *      full after the last retry.
+     */
+    bool try_enqueue_spin(Elem&& elem, std::size_t max_retries);
+
+    /**
+     * @brief Creates a new element in-place after the last element of this
+     * queue, retrying with backoff up to `max_retries` times while it is full.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param max_retries The maximum number of retries.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     * @return `true` if the element is added, `false` if this queue is still
+     *      full after the last retry.
+     * @throws Any exception thrown by the constuctor of type `Elem`.
+     */
+    template <typename... Args>
+    bool try_emplace_spin(std::size_t max_retries, Args&&... args);
+
+    /**
+     * @brief Moves the element at the front of this queue out and removes it,
+     * retrying with backoff up to `max_retries` times while it is empty.
+     *
+     * @param out The object to move-assign the front element to.
+     * @param max_retries The maximum number of retries.
+     * @return `true` if an element is removed, `false` if this queue is still
+     *      empty after the last retry.
+     * @throws Any exception thrown by the move assignment of type `Elem`, in
+     *      which case the element is removed nonetheless.
+     */
+    bool try_dequeue_spin(Elem& out, std::size_t max_retries);
+
+private:
+    // Array slot, which holds an element only if its sequence number is one
+    // past its position
+    struct Slot
+    {
+        std::atomic<std::size_t> seq;
+        alignas(Elem) std::byte  buf[sizeof(Elem)];
+
+        Elem* elem() noexcept;
+    };
+
+    // Read-only after construction, and hence shared by all threads
+    Slot*       slots_;
+    std::size_t capacity_;
+
+    // Position past the last element claimed by a producer
+    alignas(cache_line_size) std::atomic<std::size_t> tail_ { 0 };
+    // Position of the first element not yet claimed by a consumer
+    alignas(cache_line_size) std::atomic<std::size_t> head_ { 0 };
+
+    // Gets the slot at a position.
+    Slot*       slot_(std::size_t pos) const noexcept;
+    // Claims the position at the tail index if its slot is free, or returns
+    // false if this queue is full.
+    bool        claim_tail_(std::size_t& pos) noexcept;
+    // Claims the position at the head index if its slot holds an element, or
+    // returns false if this queue is empty.
+    bool        claim_head_(std::size_t& pos) noexcept;
+    // Gets the front element, which is only stable while no other thread
+    // removes elements, or nullptr if this queue is empty.
+    Elem*       peek_() const noexcept;
+
+    /** Number of elements in the queue. */
+    std::size_t size_() const noexcept;
+
+    /** Determines if this queue has no elements. */
+    bool empty_() const noexcept;
+
+    /**
+     * @brief Iterates over all elements of this queue from the front.
+     *
+     * The given operation will be performed on each element iterated.
+     * Elements added by producers during the iteration may or may not be
+     * iterated.
+     *
+     * @param action The operation to be performed on each element.
+     */
+    void iter_(std::function<void(Elem const&)> action) const;
+
+    /**
+     * @brief Accesses the element at the front of this queue.
+     *
+     * @returns The front element.
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem& front_();
+
+    /**
+     * @brief Accesses (read-only) the element at the front of this queue.
+     *
+     * @returns The front element (immutable).
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem const& front_() const;
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elem The element to be added.
+     * @throws dsa::FullQueueError if this queue is full, or any exception
+     *      thrown by the constuctor of type `Elem`.
+     */
+    void enqueue_(Elem const& elem);
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * The element will be put into the queue using move semantics.
+     *
+     * @param elem The element to be added.
+     * @throws dsa::FullQueueError if this queue is full.
+     */
+    void enqueue_(Elem&& elem);
+
+    /**
+     * @brief Removes the element at end of this queue.
+     *
+     * @throws dsa::EmptyQueueError if this queue is empty.
+     * @note The removed element is destroyed immediately.
+     */
+    void dequeue_();
+
+    /**
+     * @brief Creates a new element in-place after the last element of this
+     * queue.
+     *
+     * The new element is constructed in-place, directly in its array slot,
+     * using all of the arguments passed to this member function.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     * @throws dsa::FullQueueError if this queue is full, or any exception
+     *      thrown by the constuctor of type `Elem`.
+     */
+    template <typename... Args>
+    void emplace_(Args&&... args);
+};
+
+}   // namespace dsa
+
+#include "mpmc_ring_queue.inl"
+
+#endif /* MPMC_RING_QUEUE_HPP */
@@ -0,0 +1,289 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "mpmc_ring_queue.hpp"
+
+#include <algorithm>   // max()
+#include <cstddef>     // ptrdiff_t
+#include <memory>      // allocator<T>, construct_at(), destroy_at()
+#include <new>         // launder()
+#include <utility>     // move(), forward()
+
+namespace dsa
+{
+
+// === PUBLIC METHODS ===
+
+// clang-format off
+template <typename Elem>
+MPMCRingQueue<Elem>::MPMCRingQueue(std::size_t capacity)
+    : capacity_ { PowerOfTwoCapacity::fit(std::max(capacity,
+                                                   std::size_t { 2 })) } {
+    slots_ = std::allocator<Slot> {}.allocate(capacity_);
+    for (std::size_t i { 0 }; i < capacity_; ++i) {
+        std::construct_at(&slots_[i]);
+        slots_[i].seq.store(i, std::memory_order_relaxed);
+    }
+}
+// clang-format on
+
+template <typename Elem>
+MPMCRingQueue<Elem>::~MPMCRingQueue() {
+    for (std::size_t pos; claim_head_(pos);) {
+        std::destroy_at(slot_(pos)->elem());
+    }
+    std::allocator<Slot> {}.deallocate(slots_, capacity_);
+}
+
+template <typename Elem>
+std::size_t MPMCRingQueue<Elem>::capacity() const noexcept {
+    return capacity_;
+}
+
+template <typename Elem>
+bool MPMCRingQueue<Elem>::try_enqueue(Elem const& elem) {
+    return try_emplace(elem);
+}
+
+template <typename Elem>
+bool MPMCRingQueue<Elem>::try_enqueue(Elem&& elem) {
+    return try_emplace(std::move(elem));
+}
+
+template <typename Elem>
+template <typename... Args>
+bool MPMCRingQueue<Elem>::try_emplace(Args&&... args) {
+    if constexpr (std::is_nothrow_constructible_v<Elem, Args...>) {
+        std::size_t pos;
+        if (!claim_tail_(pos)) return false;
+        auto* const slot = slot_(pos);
+        std::construct_at(slot->elem(), std::forward<Args>(args)...);
+        // Release, so that the element is seen fully constructed
+        slot->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    } else {
+        // Constructed before a slot is claimed, as a claimed slot must be
+        // published
+        return try_emplace(Elem(std::forward<Args>(args)...));
+    }
+}
+
+template <typename Elem>
+bool MPMCRingQueue<Elem>::try_dequeue(Elem& out) {
+    std::size_t pos;
+    if (!claim_head_(pos)) return false;
+    auto* const slot = slot_(pos);
+    auto        elem = Elem(std::move(*slot->elem()));
+    std::destroy_at(slot->elem());
+    // Release, so that the slot is not reused before the element is destroyed
+    slot->seq.store(pos + capacity_, std::memory_order_release);
+    out = std::move(elem);
+    return true;
+}
+
+template <typename Elem>
+bool MPMCRingQueue<Elem>::try_enqueue_spin(Elem const& elem,
+                                           std::size_t max_retries) {
+    return try_emplace_spin(max_retries, elem);
+}
+
+template <typename Elem>
+bool MPMCRingQueue<Elem>::try_enqueue_spin(Elem&&     elem,
+                                           std::size_t max_retries) {
+    return try_emplace_spin(max_retries, std::move(elem));
+}
+
+template <typename Elem>
+template <typename... Args>
+bool MPMCRingQueue<Elem>::try_emplace_spin(std::size_t max_retries,
+                                           Args&&... args) {
+    if constexpr (std::is_nothrow_constructible_v<Elem, Args...>) {
+        // The arguments are left intact by every failed attempt
+        auto backoff = Backoff<> {};
+        for (std::size_t i { 0 };; ++i) {
+            if (try_emplace(std::forward<Args>(args)...)) return true;
+            if (i == max_retries) return false;
+            backoff();
+        }
+    } else {
+        return try_emplace_spin(max_retries, Elem(std::forward<Args>(args)...));
+    }
+}
+
+template <typename Elem>
+bool MPMCRingQueue<Elem>::try_dequeue_spin(Elem&       out,
+                                           std::size_t max_retries) {
+    auto backoff = Backoff<> {};
+    for (std::size_t i { 0 };; ++i) {
+        if (try_dequeue(out)) return true;
+        if (i == max_retries) return false;
+        backoff();
+    }
+}
+
+// === PRIVATE METHODS ===
+
+template <typename Elem>
+Elem* MPMCRingQueue<Elem>::Slot::elem() noexcept {
+    return std::launder(reinterpret_cast<Elem*>(buf));
+}
+
+template <typename Elem>
+typename MPMCRingQueue<Elem>::Slot*
+    MPMCRingQueue<Elem>::slot_(std::size_t pos) const noexcept {
+    return slots_ + PowerOfTwoCapacity::wrap(pos, capacity_);
+}
+
+template <typename Elem>
+bool MPMCRingQueue<Elem>::claim_tail_(std::size_t& pos) noexcept {
+    pos = tail_.load(std::memory_order_relaxed);
+    while (true) {
+        // Acquire, so that the slot is not reused before the consumer of the
+        // previous lap is done destroying the element in it
+        auto const seq  = slot_(pos)->seq.load(std::memory_order_acquire);
+        auto const diff = static_cast<std::ptrdiff_t>(seq - pos);
+        if (diff == 0) {
+            // The slot is free: claim it unless another producer did first
+            if (tail_.compare_exchange_weak(pos, pos + 1,
+                                            std::memory_order_relaxed)) {
+                return true;
+            }
+        } else if (diff < 0) {
+            // The slot still holds the element of the previous lap
+            return false;
+        } else {
+            // Another producer claimed the slot already
+            pos = tail_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename Elem>
+bool MPMCRingQueue<Elem>::claim_head_(std::size_t& pos) noexcept {
+    pos = head_.load(std::memory_order_relaxed);
+    while (true) {
+        // Acquire, so that the element is seen fully constructed
+        auto const seq  = slot_(pos)->seq.load(std::memory_order_acquire);
+        auto const diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+        if (diff == 0) {
+            // The slot holds an element: claim it unless another consumer did
+            // first
+            if (head_.compare_exchange_weak(pos, pos + 1,
+                                            std::memory_order_relaxed)) {
+                return true;
+            }
+        } else if (diff < 0) {
+            // The slot is yet to be published by a producer
+            return false;
+        } else {
+            // Another consumer claimed the slot already
+            pos = head_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename Elem>
+Elem* MPMCRingQueue<Elem>::peek_() const noexcept {
+    auto const  pos  = head_.load(std::memory_order_relaxed);
+    auto* const slot = slot_(pos);
+    if (slot->seq.load(std::memory_order_acquire) != pos + 1) return nullptr;
+    return slot->elem();
+}
+
+template <typename Elem>
+std::size_t MPMCRingQueue<Elem>::size_() const noexcept {
+    // The head is loaded first: it never passes the tail, which only grows,
+    // so the difference never underflows
+    auto const head = head_.load(std::memory_order_acquire);
+    return tail_.load(std::memory_order_acquire) - head;
+}
+
+template <typename Elem>
+bool MPMCRingQueue<Elem>::empty_() const noexcept {
+    return size_() == 0;
+}
+
+template <typename Elem>
+void MPMCRingQueue<Elem>::iter_(
+    std::function<void(Elem const&)> action) const {
+    auto const head = head_.load(std::memory_order_relaxed);
+    auto const tail = tail_.load(std::memory_order_acquire);
+    // Stops at the first element yet to be published
+    for (auto pos = head; pos != tail; ++pos) {
+        auto* const slot = slot_(pos);
+        if (slot->seq.load(std::memory_order_acquire) != pos + 1) break;
+        action(*slot->elem());
+    }
+}
+
+template <typename Elem>
+Elem& MPMCRingQueue<Elem>::front_() {
+    return const_cast<Elem&>(
+        const_cast<const MPMCRingQueue<Elem>*>(this)->front_());
+}
+
+template <typename Elem>
+Elem const& MPMCRingQueue<Elem>::front_() const {
+    auto const* const elem = peek_();
+    if (!elem) throw EmptyQueueError {};
+    return *elem;
+}
+
+template <typename Elem>
+void MPMCRingQueue<Elem>::enqueue_(Elem const& elem) {
+    emplace_(elem);
+}
+
+template <typename Elem>
+void MPMCRingQueue<Elem>::enqueue_(Elem&& elem) {
+    emplace_(std::move(elem));
+}
+
+template <typename Elem>
+void MPMCRingQueue<Elem>::dequeue_() {
+    std::size_t pos;
+    if (!claim_head_(pos)) throw EmptyQueueError { "dequeue from empty queue" };
+    auto* const slot = slot_(pos);
+    std::destroy_at(slot->elem());
+    slot->seq.store(pos + capacity_, std::memory_order_release);
+}
+
+template <typename Elem>
+template <typename... Args>
+void MPMCRingQueue<Elem>::emplace_(Args&&... args) {
+    if (!try_emplace(std::forward<Args>(args)...)) {
+        throw FullQueueError { "enqueue to full queue" };
+    }
+}
+
+}   // namespace dsa
@@ -0,0 +1,291 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      segmented_array_queue.hpp
+ * @brief     Segmented Array Queue
+ * @details   Unbounded, lock-free generic queue for any number of producer and
+ *            consumer threads -- an implementation of the Queue ADT using a
+ *            linked list of fixed-size array segments
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef SEGMENTED_ARRAY_QUEUE_HPP
+#define SEGMENTED_ARRAY_QUEUE_HPP
+
+#include <array>         // array<T, N>
+#include <atomic>        // atomic<T>
+#include <cstddef>       // size_t, byte
+#include <cstdint>       // uint8_t
+#include <memory>        // shared_ptr<T>
+#include <mutex>         // mutex
+#include <type_traits>   // is_nothrow_move_constructible_v<T>, ...
+#include <vector>        // vector<T>
+
+#include "adt.hpp"              // IQueue<Elem, Impl>
+#include "concurrency.hpp"      // cache_line_size
+#include "hazard_pointer.hpp"   // HazardPointer, retire()
+
+namespace dsa
+{
+
+/**
+ * @brief Segmented array queue.
+ *
+ * An unbounded, generic queue type that implements the Queue ADT
+ * `dsa::IQueue` using a linked list of array segments of `SegmentSize` slots
+ * each. Any number of threads may add and remove elements at the same time,
+ * without locking. This class template statically inherits the Queue ADT
+ * template class using the Curiously Recurring Template Pattern (CRTP).
+ *
+ * Each segment has an enqueue index and a dequeue index, after Ramalhete and
+ * Correia's FAA array queue. A producer claims the next slot of the last
+ * segment with a single fetch-and-add, constructs the element and publishes
+ * it; a consumer claims the next slot of the first segment likewise and takes
+ * the element. Contention is thus spread over fetch-and-add, which never
+ * fails, rather than compare-and-swap loops. A consumer that reaches a slot
+ * before its producer marks the slot as taken, so the producer moves on to
+ * another slot. Once a segment is full, a new segment is linked after it, so
+ * the queue grows without ever copying its elements, and allocates only once
+ * per `SegmentSize` elements. Once a segment is drained, it is unlinked and
+ * retired through `dsa::retire()`, and then kept for reuse by later segments,
+ * up to a few segments.
+ *
+ * @tparam Elem The queue element type, which must be nothrow move
+ *      constructible.
+ * @tparam SegmentSize The number of slots per segment. Defaults to 1024.
+ * @note `front()`, `iter()` and `to_string()` may only be called while no
+ *      other thread removes elements. `size()` and `empty()` may be called by
+ *      any thread, but the result may be outdated by the time it is returned,
+ *      and `size()` counts the slots skipped by consumers too. Should no
+ *      hazard pointer be available, `size()` reports 1 and `empty()` reports
+ *      `false`, as the queue may have elements, whereas `try_dequeue()` finds
+ *      none. Each element is constructed in its own slot, so `Elem` need not
+ *      be default constructible.
+ */
+template <typename Elem, std::size_t SegmentSize = 1024>
+class SegmentedArrayQueue
+    : public IQueue<Elem, SegmentedArrayQueue,
+                    SegmentedArrayQueue<Elem, SegmentSize>>
+{
+    static_assert(std::is_nothrow_move_constructible_v<Elem>,
+                  "element type must be nothrow move constructible");
+    static_assert(SegmentSize > 0, "segment size must be positive");
+
+    // Parent class, which is allowed to access the private impl methods
+    friend class IQueue<Elem, SegmentedArrayQueue,
+                        SegmentedArrayQueue<Elem, SegmentSize>>;
+
+public:
+    /**
+     * @brief Creates an empty queue.
+     *
+     * @throws std::bad_alloc if memory cannot be allocated.
+     */
+    SegmentedArrayQueue();
+    ~SegmentedArrayQueue();
+
+    // The segments are shared between threads, so a queue is neither copyable
+    // nor movable
+    SegmentedArrayQueue(SegmentedArrayQueue const&)            = delete;
+    SegmentedArrayQueue& operator=(SegmentedArrayQueue const&) = delete;
+
+    /**
+     * @brief Moves the element at the front of this queue out and removes it,
+     * unless this queue is empty.
+     *
+     * @param out The object to move-assign the front element to.
+     * @return `true` if an element is removed, `false` if this queue is empty,
+     *      or if no hazard pointer is available to access it.
+     * @throws Any exception thrown by the move assignment of type `Elem`, in
+     *      which case the element is removed nonetheless.
+     */
+    bool try_dequeue(Elem& out)
+        noexcept(std::is_nothrow_move_assignable_v<Elem>);
+
+private:
+    // Array slot, which holds an element only if full
+    struct Slot
+    {
+        // Yet to be published, or skipped by a consumer, or holding an element
+        static constexpr std::uint8_t empty { 0 }, taken { 1 }, full { 2 };
+
+        std::atomic<std::uint8_t> state { empty };
+        alignas(Elem) std::byte   buf[sizeof(Elem)];
+
+        Elem* elem() noexcept;
+    };
+
+    struct SegmentPool;
+
+    // Array segment, which is linked after the last segment once it is full
+    struct Segment
+    {
+        alignas(cache_line_size) std::atomic<std::size_t> enq_idx { 0 };
+        alignas(cache_line_size) std::atomic<std::size_t> deq_idx { 0 };
+        alignas(cache_line_size) std::atomic<Segment*>    next { nullptr };
+        // Position of this segment in the list
+        std::size_t                   id { 0 };
+        // Pool to return this segment to once reclaimed
+        std::shared_ptr<SegmentPool>  pool {};
+        std::array<Slot, SegmentSize> slots;
+    };
+
+    // Segments kept for reuse, which outlives the queue as long as retired
+    // segments are yet to be reclaimed
+    struct SegmentPool
+    {
+        std::mutex            mtx {};
+        std::vector<Segment*> segments {};
+        bool                  closed { false };
+
+        ~SegmentPool();
+    };
+
+    // Maximum number of segments kept for reuse
+    static constexpr std::size_t max_pooled_segments { 4 };
+
+    // First segment, whose dequeue index is at the front element
+    alignas(cache_line_size) std::atomic<Segment*> head_;
+    // Last segment, or a segment before it while a producer is yet to advance
+    // the tail
+    alignas(cache_line_size) std::atomic<Segment*> tail_;
+    std::shared_ptr<SegmentPool> pool_;
+
+    // Gets a segment from the pool, or allocates one.
+    Segment*    take_segment_();
+    // Returns an unused segment to its pool, or deletes it if the pool is full
+    // or closed.
+    static void recycle_(SegmentPool& pool, Segment* seg) noexcept;
+    // Reclaims a retired segment, which has no elements.
+    static void reclaim_(void* seg) noexcept;
+    // Constructs the element in `slot`, either from `args`, or by relocating
+    // it from `*pending` if it has been constructed already, and points
+    // `pending` to it.
+    template <typename... Args>
+    static void place_(Slot& slot, Elem*& pending, Args&&... args);
+    // Removes the front element, unless this queue is empty, after moving it
+    // to `*out` unless `out` is nullptr, accessing segments under `hp`.
+    bool        pop_(HazardPointer& hp, Elem* out);
+    // Gets the first published element at or after the dequeue index, or
+    // nullptr if there is none.
+    Elem*       peek_() const noexcept;
+
+    /** Number of elements in the queue. */
+    std::size_t size_() const noexcept;
+
+    /** Determines if this queue has no elements. */
+    bool empty_() const noexcept;
+
+    /**
+     * @brief Iterates over all elements of this queue from the front.
+     *
+     * The given operation will be performed on each element iterated.
+     * Elements added by producers during the iteration may or may not be
+     * iterated.
+     *
+     * @param action The operation to be performed on each element.
+     */
+    void iter_(std::function<void(Elem const&)> action) const;
+
+    /**
+     * @brief Accesses the element at the front of this queue.
+     *
+     * @returns The front element.
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem& front_();
+
+    /**
+     * @brief Accesses (read-only) the element at the front of this queue.
+     *
+     * @returns The front element (immutable).
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem const& front_() const;
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elem The element to be added.
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`.
+     */
+    void enqueue_(Elem const& elem);
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * The element will be put into the queue using move semantics.
+     *
+     * @param elem The element to be added.
+     * @throws std::bad_alloc if memory cannot be allocated.
+     */
+    void enqueue_(Elem&& elem);
+
+    /**
+     * @brief Removes the element at end of this queue.
+     *
+     * @throws dsa::EmptyQueueError if this queue is empty.
+     * @note The removed element is destroyed immediately.
+     */
+    void dequeue_();
+
+    /**
+     * @brief Creates a new element in-place after the last element of this
+     * queue.
+     *
+     * The new element is constructed in-place, directly in its array slot,
+     * using all of the arguments passed to this member function.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`.
+     */
+    template <typename... Args>
+    void emplace_(Args&&... args);
+};
+
+}   // namespace dsa
+
+#include "segmented_array_queue.inl"
+
+#endif /* SEGMENTED_ARRAY_QUEUE_HPP */
@@ -0,0 +1,374 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "segmented_array_queue.hpp"
+
+#include <algorithm>   // min()
+#include <new>         // launder()
+#include <utility>     // move(), forward(), exchange()
+
+namespace dsa
+{
+
+// === PUBLIC METHODS ===
+
+// clang-format off
+template <typename Elem, std::size_t SegmentSize>
+SegmentedArrayQueue<Elem, SegmentSize>::SegmentedArrayQueue()
+    : pool_ { std::make_shared<SegmentPool>() } {
+    auto* const seg = new Segment;
+    head_.store(seg, std::memory_order_relaxed);
+    tail_.store(seg, std::memory_order_relaxed);
+}
+// clang-format on
+
+template <typename Elem, std::size_t SegmentSize>
+SegmentedArrayQueue<Elem, SegmentSize>::~SegmentedArrayQueue() {
+    {
+        // Segments retired but yet to be reclaimed are deleted once reclaimed
+        auto lock     = std::scoped_lock { pool_->mtx };
+        pool_->closed = true;
+    }
+    // No other thread is left to access any segment
+    auto* seg = head_.load(std::memory_order_relaxed);
+    while (seg) {
+        for (auto& slot : seg->slots) {
+            if (slot.state.load(std::memory_order_relaxed) == Slot::full) {
+                std::destroy_at(slot.elem());
+            }
+        }
+        delete std::exchange(seg, seg->next.load(std::memory_order_relaxed));
+    }
+}
+
+template <typename Elem, std::size_t SegmentSize>
+bool SegmentedArrayQueue<Elem, SegmentSize>::try_dequeue(Elem& out) noexcept(
+    std::is_nothrow_move_assignable_v<Elem>) {
+    // Without a slot to protect the first segment, no element is found
+    HazardPointer hp { std::nothrow };
+    return hp && pop_(hp, &out);
+}
+
+// === PRIVATE METHODS ===
+
+template <typename Elem, std::size_t SegmentSize>
+bool SegmentedArrayQueue<Elem, SegmentSize>::pop_(HazardPointer& hp,
+                                                   Elem*          out) {
+    while (true) {
+        auto* const seg = hp.protect(head_);
+        // Checked first, so that consumers of an empty queue do not skip the
+        // slots that producers are about to fill
+        if (seg->deq_idx.load(std::memory_order_relaxed) >=
+                seg->enq_idx.load(std::memory_order_relaxed) &&
+            !seg->next.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        auto const idx = seg->deq_idx.fetch_add(1, std::memory_order_relaxed);
+        if (idx >= SegmentSize) {
+            // The segment is drained: unlink it, unless it is the last one
+            auto* next = seg->next.load(std::memory_order_acquire);
+            if (!next) return false;
+            // Advance the tail first, so that it never points to a reclaimed
+            // segment
+            auto* tail = seg;
+            tail_.compare_exchange_strong(tail, next, std::memory_order_release,
+                                          std::memory_order_relaxed);
+            auto* head = seg;
+            if (head_.compare_exchange_strong(head, next,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed)) {
+                seg->pool = pool_;
+                // No longer protected, which retiring may wait for should
+                // memory run out
+                hp.reset();
+                retire(seg, &reclaim_);
+            }
+            continue;
+        }
+
+        // Acquire, so that the element is seen fully constructed; a slot
+        // that is yet to be published is skipped, and its producer retries
+        auto& slot = seg->slots[idx];
+        if (slot.state.exchange(Slot::taken, std::memory_order_acquire) !=
+            Slot::full) {
+            continue;
+        }
+        try {
+            if (out) *out = std::move(*slot.elem());
+        }
+        catch (...) {
+            std::destroy_at(slot.elem());
+            throw;
+        }
+        std::destroy_at(slot.elem());
+        return true;
+    }
+}
+
+template <typename Elem, std::size_t SegmentSize>
+Elem* SegmentedArrayQueue<Elem, SegmentSize>::Slot::elem() noexcept {
+    return std::launder(reinterpret_cast<Elem*>(buf));
+}
+
+template <typename Elem, std::size_t SegmentSize>
+SegmentedArrayQueue<Elem, SegmentSize>::SegmentPool::~SegmentPool() {
+    for (auto* seg : segments) delete seg;
+}
+
+template <typename Elem, std::size_t SegmentSize>
+typename SegmentedArrayQueue<Elem, SegmentSize>::Segment*
+    SegmentedArrayQueue<Elem, SegmentSize>::take_segment_() {
+    {
+        auto lock = std::scoped_lock { pool_->mtx };
+        if (!pool_->segments.empty()) {
+            auto* const seg = pool_->segments.back();
+            pool_->segments.pop_back();
+            return seg;
+        }
+    }
+    return new Segment;
+}
+
+template <typename Elem, std::size_t SegmentSize>
+void SegmentedArrayQueue<Elem, SegmentSize>::recycle_(SegmentPool& pool,
+                                                      Segment* seg) noexcept {
+    {
+        auto lock = std::scoped_lock { pool.mtx };
+        if (!pool.closed && pool.segments.size() < max_pooled_segments) {
+            for (auto& slot : seg->slots) {
+                slot.state.store(Slot::empty, std::memory_order_relaxed);
+            }
+            seg->enq_idx.store(0, std::memory_order_relaxed);
+            seg->deq_idx.store(0, std::memory_order_relaxed);
+            seg->next.store(nullptr, std::memory_order_relaxed);
+            // Never reallocates, as the capacity is reserved on first use
+            if (pool.segments.capacity() == 0) {
+                pool.segments.reserve(max_pooled_segments);
+            }
+            pool.segments.push_back(seg);
+            return;
+        }
+    }
+    delete seg;
+}
+
+template <typename Elem, std::size_t SegmentSize>
+void SegmentedArrayQueue<Elem, SegmentSize>::reclaim_(void* ptr) noexcept {
+    auto* const seg  = static_cast<Segment*>(ptr);
+    auto const  pool = std::move(seg->pool);
+    recycle_(*pool, seg);
+}
+
+template <typename Elem, std::size_t SegmentSize>
+template <typename... Args>
+void SegmentedArrayQueue<Elem, SegmentSize>::place_(Slot&  slot,
+                                                    Elem*& pending,
+                                                    Args&&... args) {
+    if (pending) {
+        std::construct_at(slot.elem(), std::move(*pending));
+        std::destroy_at(pending);
+    } else {
+        std::construct_at(slot.elem(), std::forward<Args>(args)...);
+    }
+    pending = slot.elem();
+}
+
+template <typename Elem, std::size_t SegmentSize>
+Elem* SegmentedArrayQueue<Elem, SegmentSize>::peek_() const noexcept {
+    auto* seg = head_.load(std::memory_order_acquire);
+    auto  idx = seg->deq_idx.load(std::memory_order_relaxed);
+    for (; seg; seg = seg->next.load(std::memory_order_acquire), idx = 0) {
+        auto const end = std::min(
+            seg->enq_idx.load(std::memory_order_relaxed), SegmentSize);
+        for (; idx < end; ++idx) {
+            auto& slot = seg->slots[idx];
+            if (slot.state.load(std::memory_order_acquire) == Slot::full) {
+                return slot.elem();
+            }
+        }
+    }
+    return nullptr;
+}
+
+template <typename Elem, std::size_t SegmentSize>
+std::size_t SegmentedArrayQueue<Elem, SegmentSize>::size_() const noexcept {
+    // Without slots to protect the segments, this queue may have elements,
+    // as empty_() reports
+    HazardPointer hp_head { std::nothrow }, hp_tail { std::nothrow };
+    if (!hp_head || !hp_tail) return 1;
+    auto const* head = hp_head.protect(head_);
+    auto const* tail = hp_tail.protect(tail_);
+    // Positions in the whole list, bounded by their segments
+    auto const deq_pos =
+        head->id * SegmentSize +
+        std::min(head->deq_idx.load(std::memory_order_relaxed), SegmentSize);
+    auto const enq_pos =
+        tail->id * SegmentSize +
+        std::min(tail->enq_idx.load(std::memory_order_relaxed), SegmentSize);
+    return enq_pos > deq_pos ? enq_pos - deq_pos : 0;
+}
+
+template <typename Elem, std::size_t SegmentSize>
+bool SegmentedArrayQueue<Elem, SegmentSize>::empty_() const noexcept {
+    // Without a slot to protect the first segment, it may have elements
+    HazardPointer hp { std::nothrow };
+    if (!hp) return false;
+    auto const* seg = hp.protect(head_);
+    return seg->deq_idx.load(std::memory_order_relaxed) >=
+               seg->enq_idx.load(std::memory_order_relaxed) &&
+           !seg->next.load(std::memory_order_acquire);
+}
+
+template <typename Elem, std::size_t SegmentSize>
+void SegmentedArrayQueue<Elem, SegmentSize>::iter_(
+    std::function<void(Elem const&)> action) const {
+    auto* seg = head_.load(std::memory_order_acquire);
+    auto  idx = seg->deq_idx.load(std::memory_order_relaxed);
+    for (; seg; seg = seg->next.load(std::memory_order_acquire), idx = 0) {
+        auto const end = std::min(
+            seg->enq_idx.load(std::memory_order_relaxed), SegmentSize);
+        for (; idx < end; ++idx) {
+            auto& slot = seg->slots[idx];
+            if (slot.state.load(std::memory_order_acquire) == Slot::full) {
+                action(*slot.elem());
+            }
+        }
+    }
+}
+
+template <typename Elem, std::size_t SegmentSize>
+Elem& SegmentedArrayQueue<Elem, SegmentSize>::front_() {
+    return const_cast<Elem&>(
+        const_cast<const SegmentedArrayQueue<Elem, SegmentSize>*>(this)
+            ->front_());
+}
+
+template <typename Elem, std::size_t SegmentSize>
+Elem const& SegmentedArrayQueue<Elem, SegmentSize>::front_() const {
+    auto const* const elem = peek_();
+    if (!elem) throw EmptyQueueError {};
+    return *elem;
+}
+
+template <typename Elem, std::size_t SegmentSize>
+void SegmentedArrayQueue<Elem, SegmentSize>::enqueue_(Elem const& elem) {
+    emplace_(elem);
+}
+
+template <typename Elem, std::size_t SegmentSize>
+void SegmentedArrayQueue<Elem, SegmentSize>::enqueue_(Elem&& elem) {
+    emplace_(std::move(elem));
+}
+
+template <typename Elem, std::size_t SegmentSize>
+void SegmentedArrayQueue<Elem, SegmentSize>::dequeue_() {
+    HazardPointer hp;
+    if (!pop_(hp, nullptr)) {
+        throw EmptyQueueError { "dequeue from empty queue" };
+    }
+}
+
+template <typename Elem, std::size_t SegmentSize>
+template <typename... Args>
+void SegmentedArrayQueue<Elem, SegmentSize>::emplace_(Args&&... args) {
+    // Two hazard pointers take turns: one protects the segment of the slot
+    // that the element is pending in, the other the tail segment
+    HazardPointer hps[2];
+    std::size_t   cur { 0 };
+    // Where the element is, once constructed, until it is published
+    Elem*         pending { nullptr };
+    // Segment to link after the last one, which is private until linked
+    Segment*      spare { nullptr };
+
+    try {
+        while (true) {
+            auto* const seg = hps[cur].protect(tail_);
+            auto const  idx =
+                seg->enq_idx.fetch_add(1, std::memory_order_relaxed);
+            if (idx < SegmentSize) {
+                auto& slot = seg->slots[idx];
+                place_(slot, pending, std::forward<Args>(args)...);
+                // Release, so that the element is seen fully constructed
+                auto state = Slot::empty;
+                if (slot.state.compare_exchange_strong(
+                        state, Slot::full, std::memory_order_release,
+                        std::memory_order_relaxed)) {
+                    if (spare) recycle_(*pool_, spare);
+                    return;
+                }
+                // Skipped by a consumer: the element moves on to another slot
+                cur ^= 1;
+                continue;
+            }
+
+            // The segment is full: link a new one after it, unless another
+            // producer did already
+            auto* next = seg->next.load(std::memory_order_acquire);
+            if (next) {
+                auto* tail = seg;
+                tail_.compare_exchange_strong(tail, next,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed);
+                continue;
+            }
+            if (!spare) spare = take_segment_();
+            auto& first = spare->slots[0];
+            if (pending != first.elem()) {
+                place_(first, pending, std::forward<Args>(args)...);
+            }
+            first.state.store(Slot::full, std::memory_order_relaxed);
+            spare->enq_idx.store(1, std::memory_order_relaxed);
+            spare->id = seg->id + 1;
+            // Release, so that the segment is seen initialized
+            if (seg->next.compare_exchange_strong(next, spare,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed)) {
+                auto* tail = seg;
+                tail_.compare_exchange_strong(tail, spare,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed);
+                return;
+            }
+            first.state.store(Slot::empty, std::memory_order_relaxed);
+        }
+    }
+    catch (...) {
+        // Thrown by the constructor of the element, or by allocating a segment
+        if (pending) std::destroy_at(pending);
+        if (spare) recycle_(*pool_, spare);
+        throw;
+    }
+}
+
+}   // namespace dsa
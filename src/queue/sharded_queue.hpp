@@ -0,0 +1,238 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      sharded_queue.hpp
+ * @brief     Sharded Queue
+ * @details   Unbounded, thread-safe generic queue with relaxed FIFO order that
+ *            spreads its elements over several circular array queues -- an
+ *            implementation of the Queue ADT.
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef SHARDED_QUEUE_HPP
+#define SHARDED_QUEUE_HPP
+
+#include <atomic>    // atomic<T>
+#include <cstddef>   // size_t
+#include <cstdint>   // uint64_t
+#include <memory>    // unique_ptr<T[]>
+#include <mutex>     // mutex
+#include <thread>    // thread::hardware_concurrency()
+
+#include "adt.hpp"                // IQueue<Elem, Impl>
+#include "circ_array_queue.hpp"   // CircArrayQueue<Elem>
+#include "concurrency.hpp"        // cache_line_size, this_thread_index()
+
+namespace dsa
+{
+
+/**
+ * @brief Sharded queue with relaxed FIFO order.
+ *
+ * An unbounded, generic queue type that implements the Queue ADT
+ * `dsa::IQueue` using several shards, each a `dsa::CircArrayQueue` guarded by
+ * a lock of its own, for any number of producer and consumer threads. This
+ * class template statically inherits the Queue ADT template class using the
+ * Curiously Recurring Template Pattern (CRTP).
+ *
+ * Each thread is assigned a home shard round-robin, by its index
+ * `dsa::this_thread_index()`, so that up to as many threads as there are
+ * shards have one of their own. A thread always adds elements to its home
+ * shard, and removes elements from its home shard first. Once the home shard
+ * is empty, it picks two shards at random and removes from the one holding
+ * more elements (the power of two choices), skipping a shard another thread
+ * holds the lock of; and once that fails too, it visits every shard in turn.
+ * Threads thus mostly contend for a shard only when they share it, instead of
+ * all contending for a single head and tail.
+ *
+ * Ordering guarantees:
+ * - Per-producer FIFO: elements added by the same thread are removed in the
+ *   order they were added, as they all go to the same shard.
+ * - No global FIFO: elements added by different threads may be removed in any
+ *   order, even if one was added long before the other.
+ * - Elements are never lost or duplicated, and removing an element from the
+ *   queue only fails if every shard was found empty in turn.
+ *
+ * @tparam Elem The queue element type.
+ * @note `size()`, `empty()`, `front()` and `to_string()` look at the shards one
+ *      after the other, so they only give a snapshot if other threads access
+ *      the queue. A reference returned by `front()` is only valid until
+ *      another thread removes the element.
+ */
+template <typename Elem>
+class ShardedQueue : public IQueue<Elem, ShardedQueue>
+{
+    // Parent class, which is allowed to access the private impl methods
+    friend class IQueue<Elem, ShardedQueue>;
+
+public:
+    /**
+     * @brief Creates an empty queue.
+     *
+     * @param num_shards Number of shards, which is raised to one. Defaults to
+     *      the number of concurrent threads supported by the hardware.
+     * @param init_shard_cap The initially anticipated maximum number of
+     *      elements to be stored in each shard.
+     */
+    explicit ShardedQueue(
+        std::size_t num_shards     = std::thread::hardware_concurrency(),
+        std::size_t init_shard_cap = 1024);
+
+    // The shards are shared between threads, so a queue is neither copyable
+    // nor movable
+    ShardedQueue(ShardedQueue const&)            = delete;
+    ShardedQueue& operator=(ShardedQueue const&) = delete;
+
+    /**
+     * @brief Moves an element out of this queue and removes it, unless the
+     * queue is empty.
+     *
+     * @param out The object to move-assign the element to.
+     * @return `true` if an element is removed, `false` if every shard was
+     *      found empty.
+     */
+    bool try_dequeue(Elem& out);
+
+    /** Number of shards. */
+    std::size_t num_shards() const noexcept;
+
+private:
+    // Circular array queue guarded by a lock, on cache lines of its own
+    struct alignas(cache_line_size) Shard
+    {
+        mutable std::mutex       mtx {};
+        CircArrayQueue<Elem>     elems {};
+        // Number of elements, which is read without taking the lock
+        std::atomic<std::size_t> size { 0 };
+    };
+
+    std::unique_ptr<Shard[]> shards_;
+    std::size_t              num_shards_;
+
+    // Gets a pseudo-random number for the calling thread (xorshift64).
+    static std::uint64_t random_() noexcept;
+    // Gets the home shard of the calling thread.
+    Shard& home_() const noexcept;
+    // Removes the front element of a shard, whose lock is held, moving it to
+    // `out` unless `out` is null.
+    static void pop_(Shard& shard, Elem* out);
+    // Removes an element from a shard, waiting for its lock unless `wait` is
+    // false; fails if the shard is empty, or its lock is held.
+    static bool try_pop_(Shard& shard, Elem* out, bool wait);
+    // Removes an element from any shard, the home shard first.
+    bool pop_any_(Elem* out);
+
+    /** Number of elements in the queue. */
+    std::size_t size_() const noexcept;
+
+    /** Determines if this queue has no elements. */
+    bool empty_() const noexcept;
+
+    /**
+     * @brief Iterates over all elements of this queue, shard after shard,
+     * from the front of each shard.
+     *
+     * The given operation will be performed on each element iterated, with
+     * the lock of its shard held.
+     *
+     * @param action The operation to be performed on each element.
+     */
+    void iter_(std::function<void(Elem const&)> action) const;
+
+    /**
+     * @brief Accesses the front element of the first shard that is not empty.
+     *
+     * @returns The element.
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem& front_();
+
+    /**
+     * @brief Accesses (read-only) the front element of the first shard that is
+     * not empty.
+     *
+     * @returns The element (immutable).
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem const& front_() const;
+
+    /**
+     * @brief Adds an element to the end of the home shard of the calling
+     * thread.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elem The element to be added.
+     */
+    void enqueue_(Elem const& elem);
+
+    /**
+     * @brief Adds an element to the end of the home shard of the calling
+     * thread.
+     *
+     * The element will be put into the queue using move semantics.
+     *
+     * @param elem The element to be added.
+     */
+    void enqueue_(Elem&& elem);
+
+    /**
+     * @brief Removes an element of this queue, from the home shard of the
+     * calling thread first.
+     *
+     * @throws dsa::EmptyQueueError if every shard was found empty.
+     */
+    void dequeue_();
+
+    /**
+     * @brief Creates a new element in-place at the end of the home shard of
+     * the calling thread.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     */
+    template <typename... Args>
+    void emplace_(Args&&... args);
+};
+
+}   // namespace dsa
+
+#include "sharded_queue.inl"
+
+#endif /* SHARDED_QUEUE_HPP */
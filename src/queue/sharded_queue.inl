@@ -0,0 +1,197 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "sharded_queue.hpp"
+
+#include <algorithm>   // max()
+#include <utility>     // move(), forward()
+
+namespace dsa
+{
+
+// === PUBLIC METHODS ===
+
+// clang-format off
+template <typename Elem>
+ShardedQueue<Elem>::ShardedQueue(std::size_t num_shards,
+                                 std::size_t init_shard_cap)
+    : num_shards_ { std::max(num_shards, std::size_t { 1 }) } {
+    shards_ = std::make_unique<Shard[]>(num_shards_);
+    for (std::size_t i { 0 }; i < num_shards_; ++i) {
+        // Allocation is deferred until an element is added to the shard
+        shards_[i].elems = CircArrayQueue<Elem>(init_shard_cap);
+    }
+}
+// clang-format on
+
+template <typename Elem>
+bool ShardedQueue<Elem>::try_dequeue(Elem& out) {
+    return pop_any_(&out);
+}
+
+template <typename Elem>
+std::size_t ShardedQueue<Elem>::num_shards() const noexcept {
+    return num_shards_;
+}
+
+// === PRIVATE METHODS ===
+
+template <typename Elem>
+std::uint64_t ShardedQueue<Elem>::random_() noexcept {
+    // Seeded by the thread index, as the seed must be nonzero
+    thread_local std::uint64_t state { 0x9e3779b97f4a7c15
+                                       * (this_thread_index() + 1) };
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+template <typename Elem>
+typename ShardedQueue<Elem>::Shard& ShardedQueue<Elem>::home_() const noexcept {
+    return shards_[this_thread_index() % num_shards_];
+}
+
+template <typename Elem>
+void ShardedQueue<Elem>::pop_(Shard& shard, Elem* out) {
+    if (out) *out = std::move(shard.elems.front());
+    shard.elems.dequeue();
+    shard.size.store(shard.elems.size(), std::memory_order_relaxed);
+}
+
+template <typename Elem>
+bool ShardedQueue<Elem>::try_pop_(Shard& shard, Elem* out, bool wait) {
+    if (shard.size.load(std::memory_order_relaxed) == 0) return false;
+    auto lock = std::unique_lock { shard.mtx, std::defer_lock };
+    if (wait) {
+        lock.lock();
+    } else if (!lock.try_lock()) {
+        return false;
+    }
+    if (shard.elems.empty()) return false;
+    pop_(shard, out);
+    return true;
+}
+
+template <typename Elem>
+bool ShardedQueue<Elem>::pop_any_(Elem* out) {
+    auto& home = home_();
+    if (try_pop_(home, out, true)) return true;
+
+    if (num_shards_ > 1) {
+        // Power of two choices: the fuller of two shards picked at random
+        auto const r      = random_();
+        auto&      first  = shards_[r % num_shards_];
+        auto&      second = shards_[(r >> 32) % num_shards_];
+        auto&      fuller = first.size.load(std::memory_order_relaxed)
+                           >= second.size.load(std::memory_order_relaxed)
+                                ? first
+                                : second;
+        if (try_pop_(fuller, out, false)) return true;
+    }
+
+    // Every shard in turn, waiting for its lock, so that an element is only
+    // missed if it is added to a shard already visited
+    auto const start = static_cast<std::size_t>(&home - shards_.get());
+    for (std::size_t i { 1 }; i <= num_shards_; ++i) {
+        if (try_pop_(shards_[(start + i) % num_shards_], out, true)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename Elem>
+std::size_t ShardedQueue<Elem>::size_() const noexcept {
+    std::size_t size { 0 };
+    for (std::size_t i { 0 }; i < num_shards_; ++i) {
+        size += shards_[i].size.load(std::memory_order_relaxed);
+    }
+    return size;
+}
+
+template <typename Elem>
+bool ShardedQueue<Elem>::empty_() const noexcept {
+    return size_() == 0;
+}
+
+template <typename Elem>
+void ShardedQueue<Elem>::iter_(std::function<void(Elem const&)> action) const {
+    for (std::size_t i { 0 }; i < num_shards_; ++i) {
+        auto lock = std::scoped_lock { shards_[i].mtx };
+        shards_[i].elems.iter(action);
+    }
+}
+
+template <typename Elem>
+Elem& ShardedQueue<Elem>::front_() {
+    return const_cast<Elem&>(
+        const_cast<const ShardedQueue<Elem>*>(this)->front_());
+}
+
+template <typename Elem>
+Elem const& ShardedQueue<Elem>::front_() const {
+    for (std::size_t i { 0 }; i < num_shards_; ++i) {
+        auto lock = std::scoped_lock { shards_[i].mtx };
+        if (!shards_[i].elems.empty()) return shards_[i].elems.front();
+    }
+    throw EmptyQueueError {};
+}
+
+template <typename Elem>
+void ShardedQueue<Elem>::enqueue_(Elem const& elem) {
+    emplace_(elem);
+}
+
+template <typename Elem>
+void ShardedQueue<Elem>::enqueue_(Elem&& elem) {
+    emplace_(std::move(elem));
+}
+
+template <typename Elem>
+void ShardedQueue<Elem>::dequeue_() {
+    if (!pop_any_(nullptr)) {
+        throw EmptyQueueError { "dequeue from empty queue" };
+    }
+}
+
+template <typename Elem>
+template <typename... Args>
+void ShardedQueue<Elem>::emplace_(Args&&... args) {
+    auto& home = home_();
+    auto  lock = std::scoped_lock { home.mtx };
+    home.elems.emplace(std::forward<Args>(args)...);
+    home.size.store(home.elems.size(), std::memory_order_relaxed);
+}
+
+}   // namespace dsa
@@ -34,7 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * @file      sllist_queue.hpp
  * @brief     Singly Linked List Queue
  * @details   Unbounded generic queue -- an implementation of the Queue ADT
- *            using a singly, circularly linked list with a dummy header node.
+ *            using a singly, circularly linked list of pooled nodes.
  * @author    KriztoferY
  * @version   0.1.0
  * @date      2023.01.07
@@ -44,8 +44,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef SLLIST_QUEUE_HPP
 #define SLLIST_QUEUE_HPP
 
-#include <cstddef>   // size_t
-#include <memory>    // shared_ptr<T>
+#include <cstddef>           // size_t, byte
+#include <functional>        // function<T>
+#include <memory>            // allocator<T>, allocator_traits<Alloc>
+#include <memory_resource>   // pmr::polymorphic_allocator<T>
+#include <type_traits>       // is_same_v<T, U>
 
 #include "adt.hpp"   // IQueue<Elem, Impl>
 
@@ -56,40 +59,137 @@ namespace dsa
  * @brief Singly linked list queue.
  *
  * An unbounded, generic queue type that implements the Queue ADT
- * `dsa::IQueue` using a singly, circularly linked list with a dummy
- * header node. This class template statically inherits the Queue ADT template
- * class using the Curiously Recurring Template Pattern (CRTP). The
+ * `dsa::IQueue` using a singly, circularly linked list, whose last node links
+ * back to the first. This class template statically inherits the Queue ADT
+ * template class using the Curiously Recurring Template Pattern (CRTP). The
  * instantiated class type is both copyable and movable.
  *
+ * Nodes are not allocated one by one, but carved out of blocks owned by the
+ * queue, each twice the size of the one before up to a limit. The node of a
+ * removed element goes onto a free list, and is reused by the next element
+ * added. A queue whose number of elements stays below its high-water mark
+ * therefore adds and removes elements without allocating memory.
+ *
  * @tparam Elem The queue element type.
- * @note The queue elements have value semantics.
+ * @tparam Alloc The allocator, rebound to allocate the blocks of nodes, which
+ *      also constructs and destroys the elements. Defaults to
+ *      `std::allocator<Elem>`. It is propagated on copy and move as
+ *      `std::allocator_traits<Alloc>` directs; see `dsa::pmr::SLListQueue`
+ *      for a queue on a memory resource.
+ * @note The queue elements have value semantics. Each element is constructed
+ *      in its own node, so `Elem` need not be default constructible. Memory
+ *      is released only when the queue is destroyed or assigned to.
  */
-template <typename Elem>
-class SLListQueue : public IQueue<Elem, SLListQueue>
+template <typename Elem, typename Alloc = std::allocator<Elem>>
+class SLListQueue
+    : public IQueue<Elem, SLListQueue, SLListQueue<Elem, Alloc>>
 {
+    static_assert(std::is_same_v<typename Alloc::value_type, Elem>,
+                  "allocator value type must be the element type");
+
     // Parent class, which is allowed to access the private impl methods
-    friend class IQueue<Elem, SLListQueue>;
+    friend class IQueue<Elem, SLListQueue, SLListQueue<Elem, Alloc>>;
+
+    using AllocTraits = std::allocator_traits<Alloc>;
+
+    // Whether move assignment can always take over the nodes of the other
+    // queue, rather than moving its elements one by one
+    static constexpr bool moves_storage_ {
+        AllocTraits::propagate_on_container_move_assignment::value ||
+        AllocTraits::is_always_equal::value
+    };
 
 public:
-    /* --- compiler generated default impl of special member functions --- */
+    /** Type of the allocator. */
+    using allocator_type = Alloc;
+
+    /** Creates an empty queue, without allocating memory. */
+    SLListQueue() = default;
+    /** Creates an empty queue that allocates memory with `alloc`. */
+    explicit SLListQueue(Alloc const& alloc);
+    ~SLListQueue();
+
+    /**
+     * Copy-constructs a new queue from an existing queue, with the allocator
+     * that `std::allocator_traits<Alloc>` selects for a copy.
+     */
+    SLListQueue(SLListQueue const&);
+    /** Copy-constructs a new queue from an existing queue, with `alloc`. */
+    SLListQueue(SLListQueue const&, Alloc const& alloc);
+    /** Move-constructs a new queue from an existing queue. */
+    SLListQueue(SLListQueue&&) noexcept;
+    /**
+     * Move-constructs a new queue from an existing queue, with `alloc`, which
+     * moves the elements one by one unless `alloc` equals the allocator of the
+     * existing queue. The existing queue is left empty either way.
+     */
+    SLListQueue(SLListQueue&&, Alloc const& alloc);
+
+    /** Copy-assigns an existing queue to this queue. */
+    SLListQueue& operator=(SLListQueue const&);
+    /**
+     * Move-assigns an existing queue to this queue, which moves the elements
+     * one by one if the allocator is not propagated and the allocators of the
+     * two queues are not equal.
+     */
+    SLListQueue& operator=(SLListQueue&&) noexcept(moves_storage_);
+
+    /** Gets a copy of the allocator of this queue. */
+    Alloc get_allocator() const noexcept;
 
 private:
-    // List node
+    // List node, which holds an element only while linked into the list
     struct Node
     {
-        Elem                  value {};
-        std::shared_ptr<Node> next { nulltpr };
+        Node*                   next;
+        alignas(Elem) std::byte buf[sizeof(Elem)];
+
+        Elem* elem() noexcept;
+    };
+
+    // Header of nodes allocated at once, which takes the place of the first
+    // node, so that blocks are chained without allocating
+    struct Block
+    {
+        Block*      next;
+        std::size_t size;   // number of nodes, including the header
     };
 
-    // dummy node whose successor is tail node
-    std::shared_ptr<Node> header_ {};
-    std::size_t           num_elems_ { 0 };
+    static_assert(sizeof(Block) <= sizeof(Node) &&
+                  alignof(Block) <= alignof(Node));
+
+    using NodeAlloc  = typename AllocTraits::template rebind_alloc<Node>;
+    using NodeTraits = typename AllocTraits::template rebind_traits<Node>;
+
+    // Number of nodes in the first and the largest block
+    static constexpr std::size_t min_block_size { 16 };
+    static constexpr std::size_t max_block_size { 1024 };
 
-    /** Gets the head node of the underlying linked list. */
-    std::shared_ptr<Node> head_();
+    [[no_unique_address]] Alloc alloc_ {};
+    // Last node, whose successor is the first node, or nullptr if empty
+    Node*       tail_ { nullptr };
+    // Unlinked nodes, linked through their successors, and the last of them
+    Node*       free_ { nullptr };
+    Node*       free_tail_ { nullptr };
+    // Blocks of nodes, linked through their headers, and the last of them
+    Block*      blocks_ { nullptr };
+    Block*      last_block_ { nullptr };
+    std::size_t num_elems_ { 0 };
+    std::size_t num_nodes_ { 0 };
 
-    /** Gets the tail node of the underlying linked list. */
-    std::shared_ptr<Node> tail_();
+    // Allocates a block of at least `min_nodes` nodes onto the free list.
+    void  grow_(std::size_t min_nodes);
+    // Takes a node off the free list, growing it if it is empty.
+    Node* take_node_();
+    // Puts a node, which holds no element, onto the free list.
+    void  recycle_(Node* node) noexcept;
+    // Destroys all elements and puts their nodes onto the free list.
+    void  clear_() noexcept;
+    // Destroys all elements and frees all blocks.
+    void  release_() noexcept;
+    // Takes over the nodes and the elements of `other`, leaving it empty,
+    // after this queue has been released.
+    void  steal_(SLListQueue& other) noexcept;
 
     /** Number of elements in the queue. */
     std::size_t size_() const noexcept;
@@ -123,9 +223,6 @@ private:
      */
     Elem const& front_() const;
 
-    // Inserts a node at the end of the underlying linked list.
-    void append_(std::shared_ptr<Node> node);
-
     /**
      * @brief Adds an element to the end of this queue.
      *
@@ -153,6 +250,8 @@ private:
      * @brief Removes the element at end of this queue.
      *
      * @throws dsa::EmptyQueueError if this queue is empty.
+     * @note The removed element is destroyed immediately, and its node kept
+     *      for reuse.
      */
     void dequeue_();
 
@@ -160,22 +259,57 @@ private:
      * @brief Creates a new element in-place after the last element of this
      * queue.
      *
-     * The new element is constructed in-place using all of the arguments
-     * passed to this member function.
+     * The new element is constructed in-place, directly in its node, using
+     * all of the arguments passed to this member function.
      *
      * @tparam Args Types of the arguments to be passed to the constructor of
      *      the element type `Elem`.
      * @param args Variable number of arguments to be passed to the constructor
      *      of the element type `Elem`.
      * @throws std::bad_alloc or any exception thrown by the constuctor of
-     *      type `Elem`.
+     *      type `Elem`, in which case this queue is unchanged.
      */
     template <typename... Args>
     void emplace_(Args&&... args);
+
+    /**
+     * @brief Moves all elements of another queue to the end of this queue,
+     * leaving the other queue empty.
+     *
+     * If the allocators of the two queues are equal, the list of the other
+     * queue is linked after the last node of this one in constant time,
+     * without moving any element. This queue takes over the free nodes and
+     * the blocks of the other queue along with its nodes, unless this queue is
+     * empty, in which case the two queues swap their nodes, so that the other
+     * queue keeps nodes to refill. Otherwise, the elements are moved one by
+     * one.
+     *
+     * @param other The queue whose elements are to be moved.
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`, in which case the elements not yet moved remain in the
+     *      other queue.
+     */
+    void splice_(SLListQueue& other);
 };
 
+namespace pmr
+{
+
+/**
+ * @brief Singly linked list queue that allocates memory from a
+ *      `std::pmr::memory_resource`, e.g. `std::pmr::monotonic_buffer_resource`.
+ *
+ * The memory resource is passed to the constructor, and is not propagated on
+ * copy or move assignment.
+ */
+template <typename Elem>
+using SLListQueue =
+    dsa::SLListQueue<Elem, std::pmr::polymorphic_allocator<Elem>>;
+
+}   // namespace pmr
+
 }   // namespace dsa
 
 #include "sllist_queue.inl"
 
-#endif /* SLLIST_QUEUE_HPP */
\ No newline at end of file
+#endif /* SLLIST_QUEUE_HPP */
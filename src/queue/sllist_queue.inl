@@ -1,7 +1,7 @@
 /*
 BSD 3-Clause License
 
-Copyright (c) 2023, KriztoferY (https://github.com/KriztoferY)
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
 All rights reserved.
 
 Redistribution and use in source and binary forms, with or without
@@ -30,113 +30,319 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
-/*** Out-of-line definitions ***/
+/*** Inline definitions ***/
 #include "sllist_queue.hpp"
 
+#include <algorithm>   // clamp(), max()
+#include <new>         // launder(), placement new
+#include <utility>     // exchange(), forward(), move(), swap()
+
 namespace dsa
 {
 
+// === PUBLIC METHODS ===
+
+template <typename Elem, typename Alloc>
+SLListQueue<Elem, Alloc>::SLListQueue(Alloc const& alloc) : alloc_ { alloc } {}
+
+template <typename Elem, typename Alloc>
+SLListQueue<Elem, Alloc>::~SLListQueue() {
+    release_();
+}
+
+// clang-format off
+
+template <typename Elem, typename Alloc>
+SLListQueue<Elem, Alloc>::SLListQueue(SLListQueue const& other)
+    : SLListQueue { other,
+                    AllocTraits::select_on_container_copy_construction(
+                        other.alloc_) }
+{}
+
+template <typename Elem, typename Alloc>
+SLListQueue<Elem, Alloc>::SLListQueue(SLListQueue const& other,
+                                      Alloc const&       alloc)
+    : SLListQueue { alloc }
+{
+    // All nodes of the copy come from a single block
+    if (other.num_elems_ > 0) grow_(other.num_elems_);
+    other.iter_([this](Elem const& elem) { emplace_(elem); });
+}
+
+template <typename Elem, typename Alloc>
+SLListQueue<Elem, Alloc>::SLListQueue(SLListQueue&& other) noexcept
+    : SLListQueue { std::move(other.alloc_) }
+{
+    steal_(other);
+}
+
+template <typename Elem, typename Alloc>
+SLListQueue<Elem, Alloc>::SLListQueue(SLListQueue&& other,
+                                      Alloc const&  alloc)
+    : SLListQueue { alloc }
+{
+    if (alloc_ == other.alloc_) {
+        steal_(other);
+        return;
+    }
+
+    // Nodes of the other allocator cannot be taken over, so the elements are
+    // moved one by one, all into a single block
+    if (other.num_elems_ > 0) grow_(other.num_elems_);
+    for (auto* node { other.tail_ }; num_elems_ < other.num_elems_;) {
+        node = node->next;
+        emplace_(std::move_if_noexcept(*node->elem()));
+    }
+    other.release_();
+}
+
+// clang-format on
+
+template <typename Elem, typename Alloc>
+SLListQueue<Elem, Alloc>&
+    SLListQueue<Elem, Alloc>::operator=(SLListQueue const& other) {
+    if (this == &other) return *this;
+
+    constexpr bool propagates {
+        AllocTraits::propagate_on_container_copy_assignment::value
+    };
+    auto copy = SLListQueue { other, propagates ? other.alloc_ : alloc_ };
+    release_();
+    if constexpr (propagates) alloc_ = other.alloc_;
+    steal_(copy);
+
+    return *this;
+}
+
+template <typename Elem, typename Alloc>
+SLListQueue<Elem, Alloc>& SLListQueue<Elem, Alloc>::operator=(
+    SLListQueue&& other) noexcept(moves_storage_) {
+    if (this == &other) return *this;
+
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+        release_();
+        alloc_ = std::move(other.alloc_);
+        steal_(other);
+    } else if (alloc_ == other.alloc_) {
+        release_();
+        steal_(other);
+    } else {
+        // Keep the allocator of this queue, which cannot free nodes of the
+        // other allocator, and move the elements one by one
+        auto moved = SLListQueue { std::move(other), alloc_ };
+        release_();
+        steal_(moved);
+    }
+
+    return *this;
+}
+
+template <typename Elem, typename Alloc>
+Alloc SLListQueue<Elem, Alloc>::get_allocator() const noexcept {
+    return alloc_;
+}
+
 // === PRIVATE METHODS ===
 
-template <typename Elem>
-std::shared_ptr<typename SLListQueue<Elem>::Node> SLListQueue<Elem>::head_() {
-    if (auto tail_node = this->tail_(); tail_node) { return tail_node->next; }
-    return nullptr;
+template <typename Elem, typename Alloc>
+Elem* SLListQueue<Elem, Alloc>::Node::elem() noexcept {
+    return std::launder(reinterpret_cast<Elem*>(buf));
 }
 
-template <typename Elem>
-std::shared_ptr<typename SLListQueue<Elem>::Node> SLListQueue<Elem>::tail_() {
-    return this->header_->next();
+template <typename Elem, typename Alloc>
+void SLListQueue<Elem, Alloc>::grow_(std::size_t min_nodes) {
+    // Double the number of nodes, up to the largest block size at a time
+    auto const n = std::max(
+        std::clamp(num_nodes_, min_block_size, max_block_size), min_nodes);
+    auto node_alloc = NodeAlloc { alloc_ };
+    auto* nodes     = NodeTraits::allocate(node_alloc, n + 1);
+
+    // The header takes the place of the first node
+    auto* block = ::new (static_cast<void*>(nodes)) Block { blocks_, n + 1 };
+    blocks_     = block;
+    if (!last_block_) last_block_ = block;
+
+    for (std::size_t i { 1 }; i < n; ++i) nodes[i].next = nodes + i + 1;
+    nodes[n].next = free_;
+    if (!free_) free_tail_ = nodes + n;
+    free_       = nodes + 1;
+    num_nodes_ += n;
 }
 
-template <typename Elem>
-std::size_t SLListQueue<Elem>::size_() const noexcept {
-    return this->num_elems_;
+template <typename Elem, typename Alloc>
+typename SLListQueue<Elem, Alloc>::Node*
+    SLListQueue<Elem, Alloc>::take_node_() {
+    if (!free_) grow_(1);
+    auto* node = std::exchange(free_, free_->next);
+    if (!free_) free_tail_ = nullptr;
+    return node;
 }
 
-template <typename Elem>
-bool SLListQueue<Elem>::empty_() const noexcept {
-    return this->num_elems_ == 0;
+template <typename Elem, typename Alloc>
+void SLListQueue<Elem, Alloc>::recycle_(Node* node) noexcept {
+    if (!free_) free_tail_ = node;
+    node->next = free_;
+    free_      = node;
 }
 
-template <typename Elem>
-void SLListQueue<Elem>::iter_(std::function<void(Elem const&)> action) const {
-    if (auto head_node = this->head_(); head_node) {
-        auto curr_node = head_node;
-        auto n         = this->num_elems_;
-        for (std::size_t i { 0 }; i < n; ++i) {
-            action(curr_node->value);
-            curr_node = curr_node->next;
-        }
+template <typename Elem, typename Alloc>
+void SLListQueue<Elem, Alloc>::clear_() noexcept {
+    while (num_elems_ > 0) dequeue_();
+}
+
+template <typename Elem, typename Alloc>
+void SLListQueue<Elem, Alloc>::release_() noexcept {
+    clear_();
+    auto node_alloc = NodeAlloc { alloc_ };
+    while (blocks_) {
+        auto* block = std::exchange(blocks_, blocks_->next);
+        NodeTraits::deallocate(node_alloc, reinterpret_cast<Node*>(block),
+                               block->size);
     }
+    last_block_ = nullptr;
+    free_       = nullptr;
+    free_tail_  = nullptr;
+    num_nodes_  = 0;
 }
 
-template <typename Elem>
-Elem& SLListQueue<Elem>::front_() {
+template <typename Elem, typename Alloc>
+void SLListQueue<Elem, Alloc>::steal_(SLListQueue& other) noexcept {
+    tail_       = std::exchange(other.tail_, nullptr);
+    free_       = std::exchange(other.free_, nullptr);
+    free_tail_  = std::exchange(other.free_tail_, nullptr);
+    blocks_     = std::exchange(other.blocks_, nullptr);
+    last_block_ = std::exchange(other.last_block_, nullptr);
+    num_elems_  = std::exchange(other.num_elems_, 0);
+    num_nodes_  = std::exchange(other.num_nodes_, 0);
+}
+
+template <typename Elem, typename Alloc>
+std::size_t SLListQueue<Elem, Alloc>::size_() const noexcept {
+    return num_elems_;
+}
+
+template <typename Elem, typename Alloc>
+bool SLListQueue<Elem, Alloc>::empty_() const noexcept {
+    return num_elems_ == 0;
+}
+
+template <typename Elem, typename Alloc>
+void SLListQueue<Elem, Alloc>::iter_(
+    std::function<void(Elem const&)> action) const {
+    if (num_elems_ == 0) return;
+
+    auto* node = tail_;
+    for (std::size_t i { 0 }; i < num_elems_; ++i) {
+        node = node->next;
+        action(*node->elem());
+    }
+}
+
+template <typename Elem, typename Alloc>
+Elem& SLListQueue<Elem, Alloc>::front_() {
     return const_cast<Elem&>(
-        const_cast<SLListQueue<Elem> const*>(this)->front_());
+        const_cast<SLListQueue<Elem, Alloc> const*>(this)->front_());
+}
+
+template <typename Elem, typename Alloc>
+Elem const& SLListQueue<Elem, Alloc>::front_() const {
+    if (num_elems_ == 0) throw EmptyQueueError {};
+    return *tail_->next->elem();
+}
+
+template <typename Elem, typename Alloc>
+void SLListQueue<Elem, Alloc>::enqueue_(Elem const& elem) {
+    emplace_(elem);
 }
 
-template <typename Elem>
-Elem const& SLListQueue<Elem>::front_() const {
-    if (auto head_node = this->head_(); head_node) { return head_node->value; }
-    throw EmptyQueueError {};
+template <typename Elem, typename Alloc>
+void SLListQueue<Elem, Alloc>::enqueue_(Elem&& elem) {
+    emplace_(std::move(elem));
 }
 
-template <typename Elem>
-void SLListQueue<Elem>::append_(std::shared_ptr<SLListQueue<Elem>::Node> node) {
-    if (auto tail_node = this->tail_(); tail_node) {   // linked list not empty
-        // Link new tail node to head node
-        node->next      = tail_node->next;
-        // Link old tail node to new tail node
-        tail_node->next = node;
+template <typename Elem, typename Alloc>
+void SLListQueue<Elem, Alloc>::dequeue_() {
+    if (num_elems_ == 0) throw EmptyQueueError { "dequeue from empty queue" };
+
+    auto* head = tail_->next;
+    AllocTraits::destroy(alloc_, head->elem());
+    // Link the tail node to the successor of the head node, unless the head
+    // node is the only node
+    if (--num_elems_ > 0) tail_->next = head->next;
+    else tail_ = nullptr;
+    recycle_(head);
+}
+
+template <typename Elem, typename Alloc>
+template <typename... Args>
+void SLListQueue<Elem, Alloc>::emplace_(Args&&... args) {
+    auto* node = take_node_();
+    try {
+        AllocTraits::construct(alloc_, node->elem(),
+                               std::forward<Args>(args)...);
+    }
+    catch (...) {
+        recycle_(node);
+        throw;
+    }
+
+    if (tail_) {   // linked list not empty
+        // Link new tail node to head node, and old tail node to new tail node
+        node->next  = tail_->next;
+        tail_->next = node;
     } else {   // linked list is empty
         // Link new tail node to itself
         node->next = node;
     }
-    // Link header node to the new tail node
-    this->header_->next = node;
-    // Increment counter
-    this->num_elems_    += 1;
-}
-
-template <typename Elem>
-void SLListQueue<Elem>::enqueue_(Elem const& elem) {
-    auto new_node = std::make_shared<SLListQueue<Elem>::Node>(elem, nullptr);
-    this->append_(new_node);
-}
-
-template <typename Elem>
-void SLListQueue<Elem>::enqueue_(Elem&& elem) {
-    auto new_node =
-        std::make_shared<SLListQueue<Elem>::Node>(std::move(elem), nullptr);
-    this->append_(new_node);
-}
-
-template <typename Elem>
-void SLListQueue<Elem>::dequeue_() {
-    if (auto head_node = this->head_(); head_node) {
-        if (this->num_elems_ > 1) {
-            // Back link the tail node to successor of head node
-            this->tail_()->next = head_node->next;
-        } else {
-            // Break header node's link to the single (tail) node
-            this->header_->next->reset();
+    tail_ = node;
+    ++num_elems_;
+}
+
+template <typename Elem, typename Alloc>
+void SLListQueue<Elem, Alloc>::splice_(SLListQueue& other) {
+    if (other.num_elems_ == 0) return;
+
+    if (alloc_ != other.alloc_) {
+        // Nodes of the other allocator cannot be taken over
+        while (other.num_elems_ > 0) {
+            emplace_(std::move(other.front_()));
+            other.dequeue_();
         }
-        // Break head node's link to new head node
-        head_node->next->reset();
-        // Decrement counter
-        this->num_elems_ -= 1;
+        return;
     }
-    throws EmptyQueueError { "dequeue from empty queue " };
-}
 
-template <typename Elem>
-template <typename... Args>
-void SLListQueue<Elem>::emplace_(Args&&... args) {
-    auto new_node = std::make_shared<SLListQueue<Elem>::Node>(
-        std::forward<Args>(args)..., nulltpr);
-    this->append_(new_node);
+    if (num_elems_ == 0) {
+        std::swap(tail_, other.tail_);
+        std::swap(free_, other.free_);
+        std::swap(free_tail_, other.free_tail_);
+        std::swap(blocks_, other.blocks_);
+        std::swap(last_block_, other.last_block_);
+        std::swap(num_elems_, other.num_elems_);
+        std::swap(num_nodes_, other.num_nodes_);
+        return;
+    }
+
+    // Link the tail node to the head node of the other list, and the tail
+    // node of the other list to the head node
+    auto* head        = tail_->next;
+    tail_->next       = other.tail_->next;
+    other.tail_->next = head;
+    tail_             = std::exchange(other.tail_, nullptr);
+
+    // Link the free list and the blocks of the other queue after those of
+    // this queue, which both have at least one block
+    if (other.free_) {
+        if (free_) free_tail_->next = other.free_;
+        else free_ = other.free_;
+        free_tail_ = other.free_tail_;
+    }
+    last_block_->next = std::exchange(other.blocks_, nullptr);
+    last_block_       = std::exchange(other.last_block_, nullptr);
+
+    num_elems_      += std::exchange(other.num_elems_, 0);
+    num_nodes_      += std::exchange(other.num_nodes_, 0);
+    other.free_      = nullptr;
+    other.free_tail_ = nullptr;
 }
 
-}   // namespace dsa
\ No newline at end of file
+}   // namespace dsa
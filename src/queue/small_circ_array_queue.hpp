@@ -0,0 +1,246 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      small_circ_array_queue.hpp
+ * @brief     Small Circular Array Queue
+ * @details   Unbounded generic queue -- an implementation of the Queue ADT
+ *            using a circular array that is stored inline while small
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef SMALL_CIRC_ARRAY_QUEUE_HPP
+#define SMALL_CIRC_ARRAY_QUEUE_HPP
+
+#include <cstddef>       // size_t, byte
+#include <cstdint>       // int8_t
+#include <memory>        // allocator<T>, construct_at(), destroy_at()
+#include <type_traits>   // is_nothrow_move_constructible_v<T>
+
+#include "adt.hpp"                // IQueue<Elem, Impl>
+#include "circ_array_queue.hpp"   // CapacityMode, ResizePolicy
+
+namespace dsa
+{
+
+/**
+ * @brief Small circular array queue.
+ *
+ * An unbounded, generic queue type that implements the Queue ADT
+ * `dsa::IQueue` using a circular array, like `dsa::CircArrayQueue`, except
+ * that up to `N` elements are stored inline, within the queue object itself.
+ * The elements spill over to an array on the free store only when the queue
+ * grows beyond `N` elements, and move back inline when it shrinks to fit
+ * again. This class template statically inherits the Queue ADT template
+ * class using the Curiously Recurring Template Pattern (CRTP).
+ *
+ * @tparam Elem The queue element type.
+ * @tparam N The number of elements stored inline. Defaults to 8.
+ * @tparam Mode The capacity mode, which must keep `N` as is. Defaults to
+ *      `dsa::ExactCapacity`.
+ * @tparam Policy The resizing policy, which applies once the elements spill
+ *      over to the free store. Defaults to `dsa::GeometricResizing<>`.
+ * @note The queue elements have value semantics. Moving a queue whose
+ *      elements are stored inline moves the elements one by one.
+ */
+template <typename Elem, std::size_t N = 8, CapacityMode Mode = ExactCapacity,
+          ResizePolicy Policy = GeometricResizing<>>
+class SmallCircArrayQueue
+    : public IQueue<Elem, SmallCircArrayQueue,
+                    SmallCircArrayQueue<Elem, N, Mode, Policy>>
+{
+    static_assert(N > 0, "inline capacity must be positive");
+    static_assert(Mode::fit(N) == N,
+                  "inline capacity must be kept as is by the capacity mode");
+
+    // Parent class, which is allowed to access the private impl methods
+    friend class IQueue<Elem, SmallCircArrayQueue,
+                        SmallCircArrayQueue<Elem, N, Mode, Policy>>;
+
+    static constexpr bool nothrow_move_ {
+        std::is_nothrow_move_constructible_v<Elem>
+    };
+
+public:
+    /** Creates an empty queue, which allocates no memory. */
+    SmallCircArrayQueue() noexcept;
+    ~SmallCircArrayQueue();
+
+    /** Copy-constructs a new queue from an existing queue. */
+    SmallCircArrayQueue(SmallCircArrayQueue const&);
+    /** Move-constructs a new queue from an existing queue. */
+    SmallCircArrayQueue(SmallCircArrayQueue&&) noexcept(nothrow_move_);
+
+    /** Copy-assigns an existing queue to this queue. */
+    SmallCircArrayQueue& operator=(SmallCircArrayQueue const&);
+    /** Move-assigns an existing queue to this queue. */
+    SmallCircArrayQueue&
+        operator=(SmallCircArrayQueue&&) noexcept(nothrow_move_);
+
+    /**
+     * @brief Maximum number of elements this queue can store without allocating
+     * additional memory.
+     *
+     * @return The maximum number, which is `N` while the elements are stored
+     *      inline.
+     */
+    std::size_t capacity() const noexcept;
+
+    /** Determines if the elements of this queue are stored inline. */
+    bool is_inline() const noexcept;
+
+private:
+    alignas(Elem) std::byte buf_[N * sizeof(Elem)];   // inline slots
+    Elem*       elems_;   // the inline slots or an array on the free store
+    std::size_t capacity_ { N };
+    std::size_t start_idx_ { 0 };
+    std::size_t num_elems_ { 0 };
+
+    // Gets the inline slots.
+    Elem*       inline_elems_() noexcept;
+    // Destroys all elements and frees the array on the free store, if any,
+    // leaving this queue empty with its elements stored inline.
+    void        release_() noexcept;
+    // Moves all elements of `other` to this queue, which must be empty with
+    // its elements stored inline, leaving `other` likewise.
+    void        steal_(SmallCircArrayQueue& other);
+
+    // Maps a position past the end onto the underlying array.
+    std::size_t wrap_(std::size_t i) const noexcept;
+    // Grows (factor > 0) or shrinks (factor <= 0) the underlying array as
+    // the resizing policy determines, but never below `N`. Take 1 to grow,
+    // -1 to shrink by convention.
+    void        resize_(std::int8_t factor);
+    // Moves all elements to the start of the inline slots if `new_cap` is
+    // `N`, or of a new array of capacity `new_cap` on the free store.
+    void        reallocate_(std::size_t new_cap);
+
+    /** Number of elements in the queue. */
+    std::size_t size_() const noexcept;
+
+    /** Determines if this queue has no elements. */
+    bool empty_() const noexcept;
+
+    /**
+     * @brief Iterates over all elements of this queue from the front.
+     *
+     * The given operation will be performed on each element iterated.
+     *
+     * @param action The operation to be performed on each element.
+     */
+    void iter_(std::function<void(Elem const&)> action) const;
+
+    /**
+     * @brief Accesses the element at the front of this queue.
+     *
+     * @returns The front element.
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem& front_();
+
+    /**
+     * @brief Accesses (read-only) the element at the front of this queue.
+     *
+     * @returns The front element (immutable).
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem const& front_() const;
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elem The element to be added.
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`.
+     * @note Memory will be allocated on the free store prior to this
+     *      operation if the number of elements of this queue exceeds the
+     *      current capacity.
+     */
+    void enqueue_(Elem const& elem);
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * The element will be put into the queue using move semantics.
+     *
+     * @param elem The element to be added.
+     * @throws std::bad_alloc or any exception thrown by the constuctor
+     * of type `Elem`.
+     * @note Memory will be allocated on the free store prior to this
+     *      operation if the number of elements of this queue exceeds the
+     *      current capacity.
+     */
+    void enqueue_(Elem&& elem);
+
+    /**
+     * @brief Removes the element at end of this queue.
+     *
+     * @throws dsa::EmptyQueueError if this queue is empty.
+     * @note The removed element is destroyed immediately. Removing an element
+     *      will trigger memory deallocation only when the resizing policy
+     *      determines to shrink, in which case the elements move back inline
+     *      if they fit.
+     */
+    void dequeue_();
+
+    /**
+     * @brief Creates a new element in-place after the last element of this
+     * queue.
+     *
+     * The new element is constructed in-place, directly in its array slot,
+     * using all of the arguments passed to this member function.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     * @throws std::bad_alloc or any exception thrown by the constuctor of
+     *      type `Elem`.
+     * @note Memory will be allocated on the free store prior to this
+     *      operation if the number of elements of this queue exceeds the
+     *      current capacity.
+     */
+    template <typename... Args>
+    void emplace_(Args&&... args);
+};
+
+}   // namespace dsa
+
+#include "small_circ_array_queue.inl"
+
+#endif /* SMALL_CIRC_ARRAY_QUEUE_HPP */
@@ -0,0 +1,273 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "small_circ_array_queue.hpp"
+
+#include <utility>   // move_if_noexcept()
+
+namespace dsa
+{
+
+// === PUBLIC METHODS ===
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+SmallCircArrayQueue<Elem, N, Mode, Policy>::SmallCircArrayQueue() noexcept
+    : elems_ { inline_elems_() } {}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+SmallCircArrayQueue<Elem, N, Mode, Policy>::~SmallCircArrayQueue() {
+    release_();
+}
+
+// clang-format off
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+SmallCircArrayQueue<Elem, N, Mode, Policy>::SmallCircArrayQueue(
+    SmallCircArrayQueue const& other)
+    : elems_ { inline_elems_() }
+{
+    if (other.num_elems_ > N) {
+        elems_    = std::allocator<Elem> {}.allocate(other.capacity_);
+        capacity_ = other.capacity_;
+    }
+
+    // Elements are laid out from the start of the array in the copy
+    try {
+        for (; num_elems_ < other.num_elems_; ++num_elems_) {
+            std::construct_at(
+                elems_ + num_elems_,
+                other.elems_[other.wrap_(other.start_idx_ + num_elems_)]);
+        }
+    }
+    catch (...) {
+        release_();
+        throw;
+    }
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+SmallCircArrayQueue<Elem, N, Mode, Policy>::SmallCircArrayQueue(
+    SmallCircArrayQueue&& other) noexcept(nothrow_move_)
+    : elems_ { inline_elems_() }
+{
+    steal_(other);
+}
+
+// clang-format on
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+SmallCircArrayQueue<Elem, N, Mode, Policy>&
+    SmallCircArrayQueue<Elem, N, Mode, Policy>::operator=(
+        SmallCircArrayQueue const& other) {
+    if (this != &other) *this = SmallCircArrayQueue { other };
+    return *this;
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+SmallCircArrayQueue<Elem, N, Mode, Policy>&
+    SmallCircArrayQueue<Elem, N, Mode, Policy>::operator=(
+        SmallCircArrayQueue&& other) noexcept(nothrow_move_) {
+    if (this == &other) return *this;
+
+    release_();
+    steal_(other);
+
+    return *this;
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+std::size_t
+    SmallCircArrayQueue<Elem, N, Mode, Policy>::capacity() const noexcept {
+    return capacity_;
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+bool SmallCircArrayQueue<Elem, N, Mode, Policy>::is_inline() const noexcept {
+    return reinterpret_cast<std::byte const*>(elems_) == buf_;
+}
+
+// === PRIVATE METHODS ===
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+Elem* SmallCircArrayQueue<Elem, N, Mode, Policy>::inline_elems_() noexcept {
+    return reinterpret_cast<Elem*>(buf_);
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+void SmallCircArrayQueue<Elem, N, Mode, Policy>::release_() noexcept {
+    for (std::size_t i { 0 }; i < num_elems_; ++i) {
+        std::destroy_at(elems_ + wrap_(start_idx_ + i));
+    }
+    if (!is_inline()) std::allocator<Elem> {}.deallocate(elems_, capacity_);
+    elems_     = inline_elems_();
+    capacity_  = N;
+    start_idx_ = 0;
+    num_elems_ = 0;
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+void SmallCircArrayQueue<Elem, N, Mode, Policy>::steal_(
+    SmallCircArrayQueue& other) {
+    if (!other.is_inline()) {
+        elems_     = other.elems_;
+        capacity_  = other.capacity_;
+        start_idx_ = other.start_idx_;
+        num_elems_ = other.num_elems_;
+
+        other.elems_     = other.inline_elems_();
+        other.capacity_  = N;
+        other.start_idx_ = 0;
+        other.num_elems_ = 0;
+        return;
+    }
+
+    // Inline elements are moved one by one to the start of the inline slots
+    try {
+        for (; num_elems_ < other.num_elems_; ++num_elems_) {
+            std::construct_at(
+                elems_ + num_elems_,
+                std::move(other.elems_[other.wrap_(other.start_idx_ +
+                                                   num_elems_)]));
+        }
+    }
+    catch (...) {
+        release_();
+        throw;
+    }
+    other.release_();
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+std::size_t SmallCircArrayQueue<Elem, N, Mode, Policy>::wrap_(
+    std::size_t i) const noexcept {
+    return Mode::wrap(i, capacity_);
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+void SmallCircArrayQueue<Elem, N, Mode, Policy>::resize_(std::int8_t factor) {
+    if (factor > 0) {
+        if (num_elems_ == capacity_) {
+            reallocate_(Mode::fit(Policy::grow(capacity_)));
+        }
+    } else if (!is_inline()) {
+        std::size_t new_cap { Mode::fit(
+            Policy::shrink(num_elems_, capacity_)) };
+        if (new_cap < capacity_) reallocate_(new_cap > N ? new_cap : N);
+    }
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+void SmallCircArrayQueue<Elem, N, Mode, Policy>::reallocate_(
+    std::size_t new_cap) {
+    Elem* arr { new_cap == N ? inline_elems_()
+                             : std::allocator<Elem> {}.allocate(new_cap) };
+    std::size_t i { 0 };
+    try {
+        for (; i < num_elems_; ++i) {
+            std::construct_at(arr + i, std::move_if_noexcept(
+                                           elems_[wrap_(start_idx_ + i)]));
+        }
+    }
+    catch (...) {
+        std::destroy(arr, arr + i);
+        if (new_cap != N) std::allocator<Elem> {}.deallocate(arr, new_cap);
+        throw;
+    }
+    for (i = 0; i < num_elems_; ++i) {
+        std::destroy_at(elems_ + wrap_(start_idx_ + i));
+    }
+    if (!is_inline()) std::allocator<Elem> {}.deallocate(elems_, capacity_);
+    elems_     = arr;
+    capacity_  = new_cap;
+    start_idx_ = 0;
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+std::size_t SmallCircArrayQueue<Elem, N, Mode, Policy>::size_() const noexcept {
+    return num_elems_;
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+bool SmallCircArrayQueue<Elem, N, Mode, Policy>::empty_() const noexcept {
+    return num_elems_ == 0;
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+void SmallCircArrayQueue<Elem, N, Mode, Policy>::iter_(
+    std::function<void(Elem const&)> action) const {
+    for (std::size_t i { 0 }; i < num_elems_; ++i) {
+        action(elems_[wrap_(start_idx_ + i)]);
+    }
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+Elem& SmallCircArrayQueue<Elem, N, Mode, Policy>::front_() {
+    return const_cast<Elem&>(
+        const_cast<const SmallCircArrayQueue*>(this)->front_());
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+Elem const& SmallCircArrayQueue<Elem, N, Mode, Policy>::front_() const {
+    if (num_elems_ == 0) throw EmptyQueueError {};
+    return elems_[start_idx_];
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+void SmallCircArrayQueue<Elem, N, Mode, Policy>::enqueue_(Elem const& elem) {
+    emplace_(elem);
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+void SmallCircArrayQueue<Elem, N, Mode, Policy>::enqueue_(Elem&& elem) {
+    emplace_(std::move(elem));
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+void SmallCircArrayQueue<Elem, N, Mode, Policy>::dequeue_() {
+    if (num_elems_ == 0) throw EmptyQueueError { "dequeue from empty queue" };
+    std::destroy_at(elems_ + start_idx_);
+    start_idx_ = wrap_(start_idx_ + 1);
+    num_elems_ -= 1;
+    resize_(-1);
+}
+
+template <typename Elem, std::size_t N, CapacityMode Mode, ResizePolicy Policy>
+template <typename... Args>
+void SmallCircArrayQueue<Elem, N, Mode, Policy>::emplace_(Args&&... args) {
+    resize_(1);
+    std::construct_at(elems_ + wrap_(start_idx_ + num_elems_),
+                      std::forward<Args>(args)...);
+    num_elems_ += 1;
+}
+
+}   // namespace dsa
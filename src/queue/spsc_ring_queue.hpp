@@ -0,0 +1,275 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      spsc_ring_queue.hpp
+ * @brief     SPSC Ring Queue
+ * @details   Bounded, lock-free generic queue for a single producer thread and
+ *            a single consumer thread -- an implementation of the Queue ADT
+ *            using a circular array
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef SPSC_RING_QUEUE_HPP
+#define SPSC_RING_QUEUE_HPP
+
+#include <atomic>    // atomic<T>
+#include <cstddef>   // size_t
+
+#include "adt.hpp"                // IQueue<Elem, Impl>
+#include "circ_array_queue.hpp"   // PowerOfTwoCapacity
+#include "concurrency.hpp"        // cache_line_size
+
+namespace dsa
+{
+
+/**
+ * @brief Single-producer/single-consumer ring queue.
+ *
+ * A bounded, generic queue type that implements the Queue ADT `dsa::IQueue`
+ * using a circular array whose capacity is a power of two, like a
+ * `dsa::CircArrayQueue` in `dsa::PowerOfTwoCapacity` mode. One thread, the
+ * producer, may add elements while another thread, the consumer, removes them
+ * at the same time, without locking. This class template statically inherits
+ * the Queue ADT template class using the Curiously Recurring Template Pattern
+ * (CRTP).
+ *
+ * The producer owns the tail index and the consumer owns the head index. Each
+ * index is published to the other thread with release-acquire ordering, so an
+ * element is fully constructed before the consumer can see it, and fully
+ * destroyed before the producer can reuse its slot. The two indices live on
+ * separate cache lines, and each thread keeps a cached copy of the index owned
+ * by the other thread, so it only reads the shared index when the cached copy
+ * says the queue is full (producer) or empty (consumer).
+ *
+ * Adding an element to a full queue fails rather than growing the queue:
+ * `try_enqueue()` and `try_emplace()` report it by returning `false`, whereas
+ * `enqueue()` and `emplace()` throw `dsa::FullQueueError`.
+ *
+ * @tparam Elem The queue element type.
+ * @note `enqueue()`, `emplace()`, `try_enqueue()` and `try_emplace()` may only
+ *      be called by the producer, and `front()`, `dequeue()`, `try_dequeue()`,
+ *      `iter()` and `to_string()` only by the consumer. `size()` and `empty()`
+ *      may be called by either, but the result may be outdated by the time it
+ *      is returned. Array slots are raw storage, so `Elem` need not be default
+ *      constructible.
+ */
+template <typename Elem>
+class SPSCRingQueue : public IQueue<Elem, SPSCRingQueue>
+{
+    // Parent class, which is allowed to access the private impl methods
+    friend class IQueue<Elem, SPSCRingQueue>;
+
+public:
+    /**
+     * @brief Creates an empty queue.
+     *
+     * @param capacity The maximum number of elements to be stored in the
+     *      queue, which is rounded up to the next power of two (at least 1).
+     * @throws std::bad_alloc if memory cannot be allocated.
+     */
+    SPSCRingQueue(std::size_t capacity = 4096);
+    ~SPSCRingQueue();
+
+    // The indices are shared between threads, so a queue is neither copyable
+    // nor movable
+    SPSCRingQueue(SPSCRingQueue const&)            = delete;
+    SPSCRingQueue& operator=(SPSCRingQueue const&) = delete;
+
+    /**
+     * @brief Maximum number of elements this queue can store.
+     *
+     * @return The maximum number.
+     */
+    std::size_t capacity() const noexcept;
+
+    /**
+     * @brief Adds an element to the end of this queue unless it is full.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elem The element to be added.
+     * @return `true` if the element is added, `false` if this queue is full.
+     * @throws Any exception thrown by the constuctor of type `Elem`.
+     */
+    bool try_enqueue(Elem const& elem);
+
+    /**
+     * @brief Adds an element to the end of this queue unless it is full.
+     *
+     * The element will be put into the queue using move semantics.
+     *
+     * @param elem The element to be added. Left intact if this queue is full.
+     * @return `true` if the element is added, `false` if this queue is full.
+     * @throws Any exception thrown by the constuctor of type `Elem`.
+     */
+    bool try_enqueue(Elem&& elem);
+
+    /**
+     * @brief Creates a new element in-place after the last element of this
+     * queue unless it is full.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     * @return `true` if the element is added, `false` if this queue is full.
+     * @throws Any exception thrown by the constuctor of type `Elem`.
+     */
+    template <typename... Args>
+    bool try_emplace(Args&&... args);
+
+    /**
+     * @brief Moves the element at the front of this queue out and removes it,
+     * unless this queue is empty.
+     *
+     * @param out The object to move-assign the front element to.
+     * @return `true` if an element is removed, `false` if this queue is empty.
+     * @throws Any exception thrown by the move assignment of type `Elem`.
+     */
+    bool try_dequeue(Elem& out);
+
+private:
+    // Read-only after construction, and hence shared by both threads
+    Elem*       elems_;
+    std::size_t capacity_;
+
+    // Written by the producer only: position past the last element, and the
+    // head index as last seen by the producer
+    alignas(cache_line_size) std::atomic<std::size_t> tail_ { 0 };
+    std::size_t cached_head_ { 0 };
+
+    // Written by the consumer only: position of the first element, and the
+    // tail index as last seen by the consumer
+    alignas(cache_line_size) std::atomic<std::size_t> head_ { 0 };
+    mutable std::size_t cached_tail_ { 0 };
+
+    // Maps an index onto the underlying array.
+    std::size_t wrap_(std::size_t i) const noexcept;
+    // Gets the front element, or nullptr if this queue is empty. Consumer
+    // only.
+    Elem*       peek_() const noexcept;
+    // Destroys the front element, which must exist, and releases its slot to
+    // the producer. Consumer only.
+    void        pop_() noexcept;
+
+    /** Number of elements in the queue. */
+    std::size_t size_() const noexcept;
+
+    /** Determines if this queue has no elements. */
+    bool empty_() const noexcept;
+
+    /**
+     * @brief Iterates over all elements of this queue from the front.
+     *
+     * The given operation will be performed on each element iterated.
+     * Elements added by the producer during the iteration may or may not be
+     * iterated.
+     *
+     * @param action The operation to be performed on each element.
+     */
+    void iter_(std::function<void(Elem const&)> action) const;
+
+    /**
+     * @brief Accesses the element at the front of this queue.
+     *
+     * @returns The front element.
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem& front_();
+
+    /**
+     * @brief Accesses (read-only) the element at the front of this queue.
+     *
+     * @returns The front element (immutable).
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    Elem const& front_() const;
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elem The element to be added.
+     * @throws dsa::FullQueueError if this queue is full, or any exception
+     *      thrown by the constuctor of type `Elem`.
+     */
+    void enqueue_(Elem const& elem);
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * The element will be put into the queue using move semantics.
+     *
+     * @param elem The element to be added.
+     * @throws dsa::FullQueueError if this queue is full, or any exception
+     *      thrown by the constuctor of type `Elem`.
+     */
+    void enqueue_(Elem&& elem);
+
+    /**
+     * @brief Removes the element at end of this queue.
+     *
+     * @throws dsa::EmptyQueueError if this queue is empty.
+     * @note The removed element is destroyed immediately.
+     */
+    void dequeue_();
+
+    /**
+     * @brief Creates a new element in-place after the last element of this
+     * queue.
+     *
+     * The new element is constructed in-place, directly in its array slot,
+     * using all of the arguments passed to this member function.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     * @throws dsa::FullQueueError if this queue is full, or any exception
+     *      thrown by the constuctor of type `Elem`.
+     */
+    template <typename... Args>
+    void emplace_(Args&&... args);
+};
+
+}   // namespace dsa
+
+#include "spsc_ring_queue.inl"
+
+#endif /* SPSC_RING_QUEUE_HPP */
@@ -0,0 +1,184 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "spsc_ring_queue.hpp"
+
+#include <memory>    // allocator<T>, construct_at(), destroy_at()
+#include <utility>   // move(), forward()
+
+namespace dsa
+{
+
+// === PUBLIC METHODS ===
+
+// clang-format off
+template <typename Elem>
+SPSCRingQueue<Elem>::SPSCRingQueue(std::size_t capacity)
+    : capacity_ { PowerOfTwoCapacity::fit(capacity) } {
+    elems_ = std::allocator<Elem> {}.allocate(capacity_);
+}
+// clang-format on
+
+template <typename Elem>
+SPSCRingQueue<Elem>::~SPSCRingQueue() {
+    while (peek_()) pop_();
+    std::allocator<Elem> {}.deallocate(elems_, capacity_);
+}
+
+template <typename Elem>
+std::size_t SPSCRingQueue<Elem>::capacity() const noexcept {
+    return capacity_;
+}
+
+template <typename Elem>
+bool SPSCRingQueue<Elem>::try_enqueue(Elem const& elem) {
+    return try_emplace(elem);
+}
+
+template <typename Elem>
+bool SPSCRingQueue<Elem>::try_enqueue(Elem&& elem) {
+    return try_emplace(std::move(elem));
+}
+
+template <typename Elem>
+template <typename... Args>
+bool SPSCRingQueue<Elem>::try_emplace(Args&&... args) {
+    // Only the producer writes the tail, so it need not synchronize with
+    // itself
+    auto const tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ == capacity_) {
+        // Acquire, so that the slot is not reused before the consumer is done
+        // destroying the element in it
+        cached_head_ = head_.load(std::memory_order_acquire);
+        if (tail - cached_head_ == capacity_) return false;
+    }
+    std::construct_at(elems_ + wrap_(tail), std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename Elem>
+bool SPSCRingQueue<Elem>::try_dequeue(Elem& out) {
+    auto* const elem = peek_();
+    if (!elem) return false;
+    out = std::move(*elem);
+    pop_();
+    return true;
+}
+
+// === PRIVATE METHODS ===
+
+template <typename Elem>
+std::size_t SPSCRingQueue<Elem>::wrap_(std::size_t i) const noexcept {
+    return PowerOfTwoCapacity::wrap(i, capacity_);
+}
+
+template <typename Elem>
+Elem* SPSCRingQueue<Elem>::peek_() const noexcept {
+    // Only the consumer writes the head, so it need not synchronize with
+    // itself
+    auto const head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+        // Acquire, so that the element is seen fully constructed
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        if (head == cached_tail_) return nullptr;
+    }
+    return elems_ + wrap_(head);
+}
+
+template <typename Elem>
+void SPSCRingQueue<Elem>::pop_() noexcept {
+    auto const head = head_.load(std::memory_order_relaxed);
+    std::destroy_at(elems_ + wrap_(head));
+    head_.store(head + 1, std::memory_order_release);
+}
+
+template <typename Elem>
+std::size_t SPSCRingQueue<Elem>::size_() const noexcept {
+    // The head is loaded first: it never passes the tail, which only grows,
+    // so the difference never underflows
+    auto const head = head_.load(std::memory_order_acquire);
+    return tail_.load(std::memory_order_acquire) - head;
+}
+
+template <typename Elem>
+bool SPSCRingQueue<Elem>::empty_() const noexcept {
+    return size_() == 0;
+}
+
+template <typename Elem>
+void SPSCRingQueue<Elem>::iter_(
+    std::function<void(Elem const&)> action) const {
+    auto const head = head_.load(std::memory_order_relaxed);
+    auto const tail = tail_.load(std::memory_order_acquire);
+    for (auto i = head; i != tail; ++i) action(elems_[wrap_(i)]);
+}
+
+template <typename Elem>
+Elem& SPSCRingQueue<Elem>::front_() {
+    return const_cast<Elem&>(
+        const_cast<const SPSCRingQueue<Elem>*>(this)->front_());
+}
+
+template <typename Elem>
+Elem const& SPSCRingQueue<Elem>::front_() const {
+    auto const* const elem = peek_();
+    if (!elem) throw EmptyQueueError {};
+    return *elem;
+}
+
+template <typename Elem>
+void SPSCRingQueue<Elem>::enqueue_(Elem const& elem) {
+    emplace_(elem);
+}
+
+template <typename Elem>
+void SPSCRingQueue<Elem>::enqueue_(Elem&& elem) {
+    emplace_(std::move(elem));
+}
+
+template <typename Elem>
+void SPSCRingQueue<Elem>::dequeue_() {
+    if (!peek_()) throw EmptyQueueError { "dequeue from empty queue" };
+    pop_();
+}
+
+template <typename Elem>
+template <typename... Args>
+void SPSCRingQueue<Elem>::emplace_(Args&&... args) {
+    if (!try_emplace(std::forward<Args>(args)...)) {
+        throw FullQueueError { "enqueue to full queue" };
+    }
+}
+
+}   // namespace dsa
@@ -0,0 +1,265 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      static_circ_queue.hpp
+ * @brief     Static Circular Queue
+ * @details   Bounded generic queue -- an implementation of the Queue ADT
+ *            using a circular array of capacity fixed at compile time
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef STATIC_CIRC_QUEUE_HPP
+#define STATIC_CIRC_QUEUE_HPP
+
+#include <array>     // array<T, N>
+#include <bit>       // has_single_bit()
+#include <cstddef>   // size_t
+#include <memory>    // construct_at(), destroy_at()
+
+#include "adt.hpp"   // IQueue<Elem, Impl>
+
+namespace dsa
+{
+
+/**
+ * @brief Static circular queue.
+ *
+ * A bounded, generic queue type that implements the Queue ADT `dsa::IQueue`
+ * using a circular array of `N` slots stored inline, within the queue object
+ * itself. It never allocates memory. As `N` is a power of two known at compile
+ * time, array positions wrap around by masking with a constant. This class
+ * template statically inherits the Queue ADT template class using the
+ * Curiously Recurring Template Pattern (CRTP).
+ *
+ * Adding an element to a full queue fails rather than growing the queue:
+ * `try_enqueue()` and `try_emplace()` report it by returning `false`, whereas
+ * `enqueue()` and `emplace()` throw `dsa::FullQueueError`.
+ *
+ * @tparam Elem The queue element type.
+ * @tparam N The capacity, which must be a power of two. Defaults to 64.
+ * @note The queue elements have value semantics. All operations but `iter()`
+ *      and `to_string()` are `constexpr`, so a queue can be created, used and
+ *      destroyed during constant evaluation.
+ */
+template <typename Elem, std::size_t N = 64>
+class StaticCircQueue
+    : public IQueue<Elem, StaticCircQueue, StaticCircQueue<Elem, N>>
+{
+    static_assert(std::has_single_bit(N), "capacity must be a power of two");
+
+    // Parent class, which is allowed to access the private impl methods
+    friend class IQueue<Elem, StaticCircQueue, StaticCircQueue<Elem, N>>;
+
+public:
+    /** Creates an empty queue. */
+    constexpr StaticCircQueue() noexcept;
+    constexpr ~StaticCircQueue();
+
+    /** Copy-constructs a new queue from an existing queue. */
+    constexpr StaticCircQueue(StaticCircQueue const&);
+    /** Move-constructs a new queue from an existing queue. */
+    constexpr StaticCircQueue(StaticCircQueue&&);
+
+    /** Copy-assigns an existing queue to this queue. */
+    constexpr StaticCircQueue& operator=(StaticCircQueue const&);
+    /** Move-assigns an existing queue to this queue. */
+    constexpr StaticCircQueue& operator=(StaticCircQueue&&);
+
+    /**
+     * @brief Maximum number of elements this queue can store.
+     *
+     * @return The maximum number, i.e. `N`.
+     */
+    static constexpr std::size_t capacity() noexcept;
+
+    /** Determines if this queue has as many elements as it can store. */
+    constexpr bool full() const noexcept;
+
+    /**
+     * @brief Adds an element to the end of this queue unless it is full.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elem The element to be added.
+     * @return `true` if the element is added, `false` if this queue is full.
+     * @throws Any exception thrown by the constuctor of type `Elem`.
+     */
+    constexpr bool try_enqueue(Elem const& elem);
+
+    /**
+     * @brief Adds an element to the end of this queue unless it is full.
+     *
+     * The element will be put into the queue using move semantics.
+     *
+     * @param elem The element to be added. Left intact if this queue is full.
+     * @return `true` if the element is added, `false` if this queue is full.
+     * @throws Any exception thrown by the constuctor of type `Elem`.
+     */
+    constexpr bool try_enqueue(Elem&& elem);
+
+    /**
+     * @brief Creates a new element in-place after the last element of this
+     * queue unless it is full.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     * @return `true` if the element is added, `false` if this queue is full.
+     * @throws Any exception thrown by the constuctor of type `Elem`.
+     */
+    template <typename... Args>
+    constexpr bool try_emplace(Args&&... args);
+
+    /**
+     * @brief Moves the element at the front of this queue out and removes it,
+     * unless this queue is empty.
+     *
+     * @param out The object to move-assign the front element to.
+     * @return `true` if an element is removed, `false` if this queue is empty.
+     * @throws Any exception thrown by the move assignment of type `Elem`.
+     */
+    constexpr bool try_dequeue(Elem& out);
+
+private:
+    // Array slot, which holds an element only if occupied
+    union Slot
+    {
+        constexpr Slot() noexcept {}
+        constexpr ~Slot() {}
+
+        Elem elem;
+    };
+
+    std::array<Slot, N> slots_;
+    std::size_t         start_idx_ { 0 };
+    std::size_t         num_elems_ { 0 };
+
+    // Maps a position past the end onto the underlying array.
+    static constexpr std::size_t wrap_(std::size_t i) noexcept;
+    // Copy- or move-constructs all elements of `other` in this queue, which
+    // must be empty.
+    template <typename Other>
+    constexpr void               assign_(Other&& other);
+    // Destroys all elements.
+    constexpr void               clear_() noexcept;
+
+    /** Number of elements in the queue. */
+    constexpr std::size_t size_() const noexcept;
+
+    /** Determines if this queue has no elements. */
+    constexpr bool empty_() const noexcept;
+
+    /**
+     * @brief Iterates over all elements of this queue from the front.
+     *
+     * The given operation will be performed on each element iterated.
+     *
+     * @param action The operation to be performed on each element.
+     */
+    void iter_(std::function<void(Elem const&)> action) const;
+
+    /**
+     * @brief Accesses the element at the front of this queue.
+     *
+     * @returns The front element.
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    constexpr Elem& front_();
+
+    /**
+     * @brief Accesses (read-only) the element at the front of this queue.
+     *
+     * @returns The front element (immutable).
+     * @throws dsa::EmptyQueueError if the queue is empty.
+     */
+    constexpr Elem const& front_() const;
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * A deep copy of the element will be copy-constructed and then put into
+     * the queue.
+     *
+     * @param elem The element to be added.
+     * @throws dsa::FullQueueError if this queue is full, or any exception
+     *      thrown by the constuctor of type `Elem`.
+     */
+    constexpr void enqueue_(Elem const& elem);
+
+    /**
+     * @brief Adds an element to the end of this queue.
+     *
+     * The element will be put into the queue using move semantics.
+     *
+     * @param elem The element to be added.
+     * @throws dsa::FullQueueError if this queue is full, or any exception
+     *      thrown by the constuctor of type `Elem`.
+     */
+    constexpr void enqueue_(Elem&& elem);
+
+    /**
+     * @brief Removes the element at end of this queue.
+     *
+     * @throws dsa::EmptyQueueError if this queue is empty.
+     * @note The removed element is destroyed immediately.
+     */
+    constexpr void dequeue_();
+
+    /**
+     * @brief Creates a new element in-place after the last element of this
+     * queue.
+     *
+     * The new element is constructed in-place, directly in its array slot,
+     * using all of the arguments passed to this member function.
+     *
+     * @tparam Args Types of the arguments to be passed to the constructor of
+     *      the element type `Elem`.
+     * @param args Variable number of arguments to be passed to the constructor
+     *      of the element type `Elem`.
+     * @throws dsa::FullQueueError if this queue is full, or any exception
+     *      thrown by the constuctor of type `Elem`.
+     */
+    template <typename... Args>
+    constexpr void emplace_(Args&&... args);
+};
+
+}   // namespace dsa
+
+#include "static_circ_queue.inl"
+
+#endif /* STATIC_CIRC_QUEUE_HPP */
@@ -0,0 +1,212 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "static_circ_queue.hpp"
+
+#include <type_traits>   // is_rvalue_reference_v<T>
+#include <utility>       // move(), forward()
+
+namespace dsa
+{
+
+// === PUBLIC METHODS ===
+
+template <typename Elem, std::size_t N>
+constexpr StaticCircQueue<Elem, N>::StaticCircQueue() noexcept {}
+
+template <typename Elem, std::size_t N>
+constexpr StaticCircQueue<Elem, N>::~StaticCircQueue() {
+    clear_();
+}
+
+template <typename Elem, std::size_t N>
+constexpr StaticCircQueue<Elem, N>::StaticCircQueue(
+    StaticCircQueue const& other) {
+    assign_(other);
+}
+
+template <typename Elem, std::size_t N>
+constexpr StaticCircQueue<Elem, N>::StaticCircQueue(StaticCircQueue&& other) {
+    assign_(std::move(other));
+}
+
+template <typename Elem, std::size_t N>
+constexpr StaticCircQueue<Elem, N>&
+    StaticCircQueue<Elem, N>::operator=(StaticCircQueue const& other) {
+    if (this == &other) return *this;
+    clear_();
+    assign_(other);
+    return *this;
+}
+
+template <typename Elem, std::size_t N>
+constexpr StaticCircQueue<Elem, N>&
+    StaticCircQueue<Elem, N>::operator=(StaticCircQueue&& other) {
+    if (this == &other) return *this;
+    clear_();
+    assign_(std::move(other));
+    return *this;
+}
+
+template <typename Elem, std::size_t N>
+constexpr std::size_t StaticCircQueue<Elem, N>::capacity() noexcept {
+    return N;
+}
+
+template <typename Elem, std::size_t N>
+constexpr bool StaticCircQueue<Elem, N>::full() const noexcept {
+    return num_elems_ == N;
+}
+
+template <typename Elem, std::size_t N>
+constexpr bool StaticCircQueue<Elem, N>::try_enqueue(Elem const& elem) {
+    return try_emplace(elem);
+}
+
+template <typename Elem, std::size_t N>
+constexpr bool StaticCircQueue<Elem, N>::try_enqueue(Elem&& elem) {
+    return try_emplace(std::move(elem));
+}
+
+template <typename Elem, std::size_t N>
+template <typename... Args>
+constexpr bool StaticCircQueue<Elem, N>::try_emplace(Args&&... args) {
+    if (num_elems_ == N) return false;
+    std::construct_at(&slots_[wrap_(start_idx_ + num_elems_)].elem,
+                      std::forward<Args>(args)...);
+    num_elems_ += 1;
+    return true;
+}
+
+template <typename Elem, std::size_t N>
+constexpr bool StaticCircQueue<Elem, N>::try_dequeue(Elem& out) {
+    if (num_elems_ == 0) return false;
+    out = std::move(slots_[start_idx_].elem);
+    dequeue_();
+    return true;
+}
+
+// === PRIVATE METHODS ===
+
+template <typename Elem, std::size_t N>
+constexpr std::size_t StaticCircQueue<Elem, N>::wrap_(std::size_t i) noexcept {
+    return i & (N - 1);
+}
+
+template <typename Elem, std::size_t N>
+template <typename Other>
+constexpr void StaticCircQueue<Elem, N>::assign_(Other&& other) {
+    // Elements are laid out from the start of the array in the copy
+    try {
+        for (; num_elems_ < other.num_elems_; ++num_elems_) {
+            auto& elem =
+                other.slots_[wrap_(other.start_idx_ + num_elems_)].elem;
+            if constexpr (std::is_rvalue_reference_v<Other&&>) {
+                std::construct_at(&slots_[num_elems_].elem, std::move(elem));
+            } else {
+                std::construct_at(&slots_[num_elems_].elem, elem);
+            }
+        }
+    }
+    catch (...) {
+        clear_();
+        throw;
+    }
+}
+
+template <typename Elem, std::size_t N>
+constexpr void StaticCircQueue<Elem, N>::clear_() noexcept {
+    for (; num_elems_ > 0; --num_elems_) {
+        std::destroy_at(&slots_[start_idx_].elem);
+        start_idx_ = wrap_(start_idx_ + 1);
+    }
+    start_idx_ = 0;
+}
+
+template <typename Elem, std::size_t N>
+constexpr std::size_t StaticCircQueue<Elem, N>::size_() const noexcept {
+    return num_elems_;
+}
+
+template <typename Elem, std::size_t N>
+constexpr bool StaticCircQueue<Elem, N>::empty_() const noexcept {
+    return num_elems_ == 0;
+}
+
+template <typename Elem, std::size_t N>
+void StaticCircQueue<Elem, N>::iter_(
+    std::function<void(Elem const&)> action) const {
+    for (std::size_t i { 0 }; i < num_elems_; ++i) {
+        action(slots_[wrap_(start_idx_ + i)].elem);
+    }
+}
+
+template <typename Elem, std::size_t N>
+constexpr Elem& StaticCircQueue<Elem, N>::front_() {
+    return const_cast<Elem&>(
+        const_cast<const StaticCircQueue<Elem, N>*>(this)->front_());
+}
+
+template <typename Elem, std::size_t N>
+constexpr Elem const& StaticCircQueue<Elem, N>::front_() const {
+    if (num_elems_ == 0) throw EmptyQueueError {};
+    return slots_[start_idx_].elem;
+}
+
+template <typename Elem, std::size_t N>
+constexpr void StaticCircQueue<Elem, N>::enqueue_(Elem const& elem) {
+    emplace_(elem);
+}
+
+template <typename Elem, std::size_t N>
+constexpr void StaticCircQueue<Elem, N>::enqueue_(Elem&& elem) {
+    emplace_(std::move(elem));
+}
+
+template <typename Elem, std::size_t N>
+constexpr void StaticCircQueue<Elem, N>::dequeue_() {
+    if (num_elems_ == 0) throw EmptyQueueError { "dequeue from empty queue" };
+    std::destroy_at(&slots_[start_idx_].elem);
+    start_idx_ = wrap_(start_idx_ + 1);
+    num_elems_ -= 1;
+}
+
+template <typename Elem, std::size_t N>
+template <typename... Args>
+constexpr void StaticCircQueue<Elem, N>::emplace_(Args&&... args) {
+    if (!try_emplace(std::forward<Args>(args)...)) {
+        throw FullQueueError { "enqueue to full queue" };
+    }
+}
+
+}   // namespace dsa
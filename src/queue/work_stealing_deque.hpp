@@ -0,0 +1,189 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      work_stealing_deque.hpp
+ * @brief     Work-Stealing Deque
+ * @details   Unbounded, lock-free double-ended queue whose owner thread adds
+ *            and removes elements at one end while other threads steal
+ *            elements from the other end, after Chase and Lev.
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef WORK_STEALING_DEQUE_HPP
+#define WORK_STEALING_DEQUE_HPP
+
+#include <atomic>        // atomic<T>
+#include <cstddef>       // size_t
+#include <cstdint>       // int64_t
+#include <memory>        // unique_ptr<T>
+#include <type_traits>   // is_trivially_copyable_v<T>
+#include <vector>        // vector<T>
+
+#include "concurrency.hpp"   // cache_line_size
+
+namespace dsa
+{
+
+/**
+ * @brief Chase-Lev work-stealing deque.
+ *
+ * An unbounded, generic double-ended queue type for the scheduler of a thread
+ * pool. A single thread, the owner, adds elements to and removes elements
+ * from the bottom of the deque, in LIFO order, as if it were a stack. Any
+ * other thread, a thief, may at the same time steal elements from the top of
+ * the deque, in FIFO order. Neither end is ever locked.
+ *
+ * The owner works on the elements it added most recently, whose data is most
+ * likely still in its cache, and only contends with thieves for the last
+ * element. Thieves take the oldest elements, which in a divide-and-conquer
+ * computation tend to stand for the largest pieces of work.
+ *
+ * The elements live in a circular array whose capacity is a power of two,
+ * which the owner doubles when it is full. As a thief may still read an
+ * element from an array that has just been replaced, the replaced arrays are
+ * only freed when the deque is destroyed, which takes up to as much memory
+ * again as the largest array.
+ *
+ * @tparam Elem The element type, which must be trivially copyable, e.g. a
+ *      pointer to a task. A thief reads an element before it knows whether
+ *      the element is its to take, so the element is read and written as a
+ *      whole, atomically.
+ */
+template <typename Elem>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable_v<Elem>,
+                  "WorkStealingDeque requires trivially copyable elements");
+
+public:
+    /**
+     * @brief Creates an empty deque.
+     *
+     * @param capacity Initial capacity of the deque, which is rounded up to a
+     *      power of two. Defaults to 64.
+     */
+    explicit WorkStealingDeque(std::size_t capacity = 64);
+
+    // The deque is shared between threads, so a deque is neither copyable nor
+    // movable
+    WorkStealingDeque(WorkStealingDeque const&)            = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque const&) = delete;
+
+    /**
+     * @brief Adds an element to the bottom of this deque.
+     *
+     * The capacity of the deque is doubled if it is full. Must only be called
+     * by the owner thread.
+     *
+     * @param elem The element to be added.
+     * @throws std::bad_alloc if the deque fails to grow.
+     */
+    void push(Elem elem);
+
+    /**
+     * @brief Removes the element at the bottom of this deque, i.e. the element
+     * added most recently, unless the deque is empty.
+     *
+     * Must only be called by the owner thread.
+     *
+     * @param out The object to assign the removed element to.
+     * @return `true` if an element is removed, `false` if this deque is empty,
+     *      or if a thief stole the last element first.
+     */
+    bool try_pop(Elem& out) noexcept;
+
+    /**
+     * @brief Removes the element at the top of this deque, i.e. the element
+     * added least recently, unless the deque is empty.
+     *
+     * May be called by any thread.
+     *
+     * @param out The object to assign the removed element to.
+     * @return `true` if an element is removed, `false` if this deque is empty,
+     *      or if the owner or another thief removed the element first.
+     */
+    bool try_steal(Elem& out) noexcept;
+
+    /**
+     * @brief Number of elements in this deque.
+     *
+     * The number is only a snapshot if other threads access the deque.
+     */
+    std::size_t size() const noexcept;
+
+    /**
+     * @brief Determines if this deque has no elements.
+     *
+     * The answer is only a snapshot if other threads access the deque.
+     */
+    bool empty() const noexcept;
+
+    /** Number of elements this deque can hold before it grows. */
+    std::size_t capacity() const noexcept;
+
+private:
+    // Circular array of elements, which is replaced rather than resized
+    struct Array
+    {
+        std::size_t                          capacity;
+        std::unique_ptr<std::atomic<Elem>[]> elems;
+
+        explicit Array(std::size_t capacity_);
+
+        Elem get(std::int64_t i) const noexcept;
+        void put(std::int64_t i, Elem elem) noexcept;
+    };
+
+    // Index past the bottom element, which only the owner writes
+    alignas(cache_line_size) std::atomic<std::int64_t> bottom_ { 0 };
+    // Current array, which only the owner replaces
+    std::atomic<Array*> array_;
+    // Arrays owned by the deque, the current one last (owner only)
+    std::vector<std::unique_ptr<Array>> arrays_ {};
+
+    // Index of the top element, which thieves and the owner advance
+    alignas(cache_line_size) std::atomic<std::int64_t> top_ { 0 };
+
+    // Replaces the array with one of twice its capacity holding the elements
+    // between the top and bottom indices.
+    Array* grow_(Array* array, std::int64_t top, std::int64_t bottom);
+};
+
+}   // namespace dsa
+
+#include "work_stealing_deque.inl"
+
+#endif /* WORK_STEALING_DEQUE_HPP */
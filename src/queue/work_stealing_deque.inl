@@ -0,0 +1,159 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "work_stealing_deque.hpp"
+
+#include <algorithm>   // max()
+#include <bit>         // bit_ceil()
+
+namespace dsa
+{
+
+// === PUBLIC METHODS ===
+
+template <typename Elem>
+WorkStealingDeque<Elem>::WorkStealingDeque(std::size_t capacity) {
+    arrays_.push_back(std::make_unique<Array>(
+        std::bit_ceil(std::max(capacity, std::size_t { 1 }))));
+    array_.store(arrays_.back().get(), std::memory_order_relaxed);
+}
+
+template <typename Elem>
+void WorkStealingDeque<Elem>::push(Elem elem) {
+    auto const bottom = bottom_.load(std::memory_order_relaxed);
+    auto const top    = top_.load(std::memory_order_acquire);
+    auto*      array  = array_.load(std::memory_order_relaxed);
+    if (bottom - top >= static_cast<std::int64_t>(array->capacity)) {
+        array = grow_(array, top, bottom);
+    }
+    array->put(bottom, elem);
+    // Release, so that a thief that sees the new bottom also sees the element
+    bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+template <typename Elem>
+bool WorkStealingDeque<Elem>::try_pop(Elem& out) noexcept {
+    auto const  bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    auto const* array  = array_.load(std::memory_order_relaxed);
+    // The bottom element is reserved before the top is read, and a thief
+    // reads the top before the bottom, so the two cannot both take an element
+    // unless it is the last one, which they then race for on the top index
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto top = top_.load(std::memory_order_relaxed);
+
+    if (top > bottom) {
+        // Empty: the reservation is undone
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+    out = array->get(bottom);
+    if (top < bottom) return true;
+
+    // Last element: taken by whoever advances the top first
+    auto const taken = top_.compare_exchange_strong(
+        top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return taken;
+}
+
+template <typename Elem>
+bool WorkStealingDeque<Elem>::try_steal(Elem& out) noexcept {
+    auto top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto const bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) return false;
+
+    // Read before the element is taken, as the owner may overwrite its slot
+    // as soon as the top advances
+    auto const elem = array_.load(std::memory_order_acquire)->get(top);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+        return false;
+    }
+    out = elem;
+    return true;
+}
+
+template <typename Elem>
+std::size_t WorkStealingDeque<Elem>::size() const noexcept {
+    auto const top    = top_.load(std::memory_order_acquire);
+    auto const bottom = bottom_.load(std::memory_order_acquire);
+    return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+}
+
+template <typename Elem>
+bool WorkStealingDeque<Elem>::empty() const noexcept {
+    return size() == 0;
+}
+
+template <typename Elem>
+std::size_t WorkStealingDeque<Elem>::capacity() const noexcept {
+    return array_.load(std::memory_order_acquire)->capacity;
+}
+
+// === PRIVATE METHODS ===
+
+// clang-format off
+template <typename Elem>
+WorkStealingDeque<Elem>::Array::Array(std::size_t capacity_)
+    : capacity { capacity_ }
+    , elems { std::make_unique<std::atomic<Elem>[]>(capacity_) } {}
+// clang-format on
+
+template <typename Elem>
+Elem WorkStealingDeque<Elem>::Array::get(std::int64_t i) const noexcept {
+    return elems[static_cast<std::size_t>(i) & (capacity - 1)].load(
+        std::memory_order_relaxed);
+}
+
+template <typename Elem>
+void WorkStealingDeque<Elem>::Array::put(std::int64_t i, Elem elem) noexcept {
+    elems[static_cast<std::size_t>(i) & (capacity - 1)].store(
+        elem, std::memory_order_relaxed);
+}
+
+template <typename Elem>
+typename WorkStealingDeque<Elem>::Array*
+    WorkStealingDeque<Elem>::grow_(Array* array, std::int64_t top,
+                                   std::int64_t bottom) {
+    auto        grown = std::make_unique<Array>(array->capacity * 2);
+    auto* const to    = grown.get();
+    for (auto i = top; i != bottom; ++i) to->put(i, array->get(i));
+    arrays_.push_back(std::move(grown));
+    // Release, so that a thief that sees the new array sees its elements
+    array_.store(to, std::memory_order_release);
+    return to;
+}
+
+}   // namespace dsa
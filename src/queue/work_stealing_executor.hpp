@@ -0,0 +1,203 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file      work_stealing_executor.hpp
+ * @brief     Work-Stealing Executor
+ * @details   Thread pool that runs tasks from a work-stealing deque per worker
+ *            thread.
+ * @author    KriztoferY
+ * @version   0.1.0
+ * @date      2026.10.16
+ * @copyright Copyright (c) 2026 KriztoferY. All rights reserved.
+ */
+
+#ifndef WORK_STEALING_EXECUTOR_HPP
+#define WORK_STEALING_EXECUTOR_HPP
+
+#include <atomic>        // atomic<T>
+#include <concepts>      // invocable<F>
+#include <cstddef>       // size_t
+#include <cstdint>       // uint32_t, uint64_t
+#include <exception>     // exception_ptr
+#include <functional>    // function<F>
+#include <memory>        // unique_ptr<T>
+#include <mutex>         // mutex
+#include <thread>        // thread
+#include <type_traits>   // decay_t<T>
+#include <vector>        // vector<T>
+
+#include "concurrency.hpp"             // cache_line_size, futex_wait(), ...
+#include "segmented_array_queue.hpp"   // SegmentedArrayQueue<Elem>
+#include "work_stealing_deque.hpp"     // WorkStealingDeque<Elem>
+
+namespace dsa
+{
+
+/**
+ * @brief Work-stealing thread pool.
+ *
+ * Runs tasks, i.e. callables taking no arguments, on a fixed number of worker
+ * threads. Each worker has a `dsa::WorkStealingDeque` of its own: a task
+ * submitted by a task running on a worker is added to the bottom of the
+ * worker's deque, and the worker runs the tasks of its deque most recent
+ * first. A worker whose deque is empty takes a task submitted from outside
+ * the pool, which is added to a shared `dsa::SegmentedArrayQueue`, or else
+ * steals the oldest task of another worker, chosen at random. Workers thus
+ * mostly work on their own deques, instead of all contending for a single
+ * shared queue.
+ *
+ * A worker that finds no task sleeps on a futex (`dsa::futex_wait()`), and is
+ * woken when a task is submitted. A thread that submits a task only enters the
+ * kernel if a worker is sleeping.
+ *
+ * @note An exception thrown by a task is caught by the worker running it, and
+ *      the first one is rethrown by `wait()`.
+ */
+class WorkStealingExecutor
+{
+public:
+    /** Type-erased task. */
+    using Task = std::function<void()>;
+
+    /**
+     * @brief Creates a thread pool and starts its worker threads.
+     *
+     * @param num_workers Number of worker threads, which is raised to one.
+     *      Defaults to the number of concurrent threads supported by the
+     *      hardware.
+     * @throws std::system_error if a worker thread fails to start.
+     */
+    explicit WorkStealingExecutor(
+        std::size_t num_workers = std::thread::hardware_concurrency());
+
+    /**
+     * @brief Waits for all submitted tasks to be run, then stops the worker
+     * threads.
+     *
+     * An exception thrown by a task and not yet rethrown by `wait()` is
+     * discarded.
+     */
+    ~WorkStealingExecutor();
+
+    // Worker threads refer to the pool, so a pool is neither copyable nor
+    // movable
+    WorkStealingExecutor(WorkStealingExecutor const&)            = delete;
+    WorkStealingExecutor& operator=(WorkStealingExecutor const&) = delete;
+
+    /**
+     * @brief Submits a task to be run by a worker thread.
+     *
+     * A task submitted by a task running on this pool is added to the deque of
+     * the worker running it; otherwise, it is added to the queue shared by all
+     * workers.
+     *
+     * @tparam F Type of the task.
+     * @param task The task to run, which is copied or moved into the pool.
+     */
+    template <typename F>
+        requires std::invocable<std::decay_t<F>&>
+    void submit(F&& task);
+
+    /**
+     * @brief Waits until all submitted tasks, including those submitted by
+     * tasks while waiting, have been run.
+     *
+     * Must not be called by a task running on this pool.
+     *
+     * @throws Rethrows the first exception thrown by a task since the last
+     *      call, if any.
+     */
+    void wait();
+
+    /** Number of worker threads. */
+    std::size_t num_workers() const noexcept;
+
+private:
+    // Deque of tasks owned by a worker thread
+    struct Worker
+    {
+        WorkStealingExecutor*    pool;
+        // State of the generator that picks a victim to steal from
+        std::uint64_t            seed;
+        WorkStealingDeque<Task*> tasks {};
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers_ {};
+    std::vector<std::thread>             threads_ {};
+    // Tasks submitted from outside the pool
+    SegmentedArrayQueue<Task*>           injected_ {};
+
+    // Futex word that sleeping workers wait on, which changes whenever a task
+    // is submitted while a worker sleeps; and the number of workers sleeping
+    // or about to sleep on it
+    alignas(cache_line_size) std::atomic<std::uint32_t> work_seq_ { 0 };
+    std::atomic<std::uint32_t> num_sleepers_ { 0 };
+
+    // Number of tasks submitted but yet to be run; futex word that threads
+    // waiting for the pool to be idle wait on, which changes whenever the
+    // number drops to zero while a thread waits; and the number of threads
+    // waiting or about to wait on it
+    alignas(cache_line_size) std::atomic<std::size_t> num_pending_ { 0 };
+    std::atomic<std::uint32_t> idle_seq_ { 0 };
+    std::atomic<std::uint32_t> num_idle_waiters_ { 0 };
+
+    alignas(cache_line_size) std::atomic<bool> stopping_ { false };
+
+    std::mutex         error_mtx_ {};
+    std::exception_ptr error_ {};
+
+    // Gets the worker run by the calling thread, if any.
+    static Worker*& current_() noexcept;
+
+    // Adds a task counted as pending, and wakes a sleeping worker.
+    void push_(Task* task);
+    // Takes a task from the worker's own deque, the shared queue or another
+    // worker's deque, in that order.
+    Task* find_task_(Worker& self) noexcept;
+    // Runs a task, and deletes it.
+    void execute_(Task* task) noexcept;
+    // Counts a pending task as done.
+    void finish_() noexcept;
+    // Waits until no task is pending.
+    void await_idle_() noexcept;
+    // Stops and joins the worker threads started so far.
+    void stop_() noexcept;
+    // Main loop of a worker thread.
+    void run_(Worker& self) noexcept;
+};
+
+}   // namespace dsa
+
+#include "work_stealing_executor.inl"
+
+#endif /* WORK_STEALING_EXECUTOR_HPP */
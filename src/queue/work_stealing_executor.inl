@@ -0,0 +1,203 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*** Inline definitions ***/
+#include "work_stealing_executor.hpp"
+
+#include <algorithm>   // max()
+#include <climits>     // INT_MAX
+#include <utility>     // forward(), exchange()
+
+namespace dsa
+{
+
+// === PUBLIC METHODS ===
+
+inline WorkStealingExecutor::WorkStealingExecutor(std::size_t num_workers) {
+    num_workers = std::max(num_workers, std::size_t { 1 });
+    workers_.reserve(num_workers);
+    for (std::size_t i { 0 }; i < num_workers; ++i) {
+        // Distinct, nonzero seeds
+        workers_.push_back(
+            std::make_unique<Worker>(this, 0x9e3779b97f4a7c15 * (i + 1)));
+    }
+    try {
+        threads_.reserve(num_workers);
+        for (auto& worker : workers_) {
+            threads_.emplace_back([this, &worker = *worker] { run_(worker); });
+        }
+    }
+    catch (...) {
+        stop_();
+        throw;
+    }
+}
+
+inline WorkStealingExecutor::~WorkStealingExecutor() {
+    await_idle_();
+    stop_();
+}
+
+template <typename F>
+    requires std::invocable<std::decay_t<F>&>
+void WorkStealingExecutor::submit(F&& task) {
+    push_(new Task(std::forward<F>(task)));
+}
+
+inline void WorkStealingExecutor::wait() {
+    await_idle_();
+    auto lock = std::scoped_lock { error_mtx_ };
+    if (error_) std::rethrow_exception(std::exchange(error_, nullptr));
+}
+
+inline std::size_t WorkStealingExecutor::num_workers() const noexcept {
+    return workers_.size();
+}
+
+// === PRIVATE METHODS ===
+
+inline WorkStealingExecutor::Worker*&
+    WorkStealingExecutor::current_() noexcept {
+    thread_local Worker* worker { nullptr };
+    return worker;
+}
+
+inline void WorkStealingExecutor::push_(Task* task) {
+    num_pending_.fetch_add(1, std::memory_order_relaxed);
+    try {
+        auto* const self = current_();
+        if (self && self->pool == this) {
+            self->tasks.push(task);
+        } else {
+            injected_.enqueue(task);
+        }
+    }
+    catch (...) {
+        delete task;
+        finish_();
+        throw;
+    }
+
+    // Pairs with the fence in run_(): either a worker about to sleep is
+    // counted in here, or it finds the task on its last attempt
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (num_sleepers_.load(std::memory_order_relaxed) == 0) return;
+    work_seq_.fetch_add(1, std::memory_order_release);
+    futex_wake(work_seq_, 1);
+}
+
+inline WorkStealingExecutor::Task*
+    WorkStealingExecutor::find_task_(Worker& self) noexcept {
+    Task* task { nullptr };
+    if (self.tasks.try_pop(task) || injected_.try_dequeue(task)) return task;
+
+    // Steals from every other worker once, from a victim picked at random
+    // (xorshift64), so that thieves spread over the workers
+    self.seed ^= self.seed << 13;
+    self.seed ^= self.seed >> 7;
+    self.seed ^= self.seed << 17;
+    auto const num_workers = workers_.size();
+    auto const first       = static_cast<std::size_t>(self.seed % num_workers);
+    for (std::size_t i { 0 }; i < num_workers; ++i) {
+        auto& victim = *workers_[(first + i) % num_workers];
+        if (&victim != &self && victim.tasks.try_steal(task)) return task;
+    }
+    return nullptr;
+}
+
+inline void WorkStealingExecutor::execute_(Task* task) noexcept {
+    try {
+        (*task)();
+    }
+    catch (...) {
+        auto lock = std::scoped_lock { error_mtx_ };
+        if (!error_) error_ = std::current_exception();
+    }
+    delete task;
+    finish_();
+}
+
+inline void WorkStealingExecutor::finish_() noexcept {
+    if (num_pending_.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+    // Pairs with the fence in await_idle_()
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (num_idle_waiters_.load(std::memory_order_relaxed) == 0) return;
+    idle_seq_.fetch_add(1, std::memory_order_release);
+    futex_wake(idle_seq_, INT_MAX);
+}
+
+inline void WorkStealingExecutor::await_idle_() noexcept {
+    while (true) {
+        auto const old = idle_seq_.load(std::memory_order_acquire);
+        num_idle_waiters_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto const idle = num_pending_.load(std::memory_order_acquire) == 0;
+        if (!idle) futex_wait(idle_seq_, old);
+        num_idle_waiters_.fetch_sub(1, std::memory_order_relaxed);
+        if (idle) return;
+    }
+}
+
+inline void WorkStealingExecutor::stop_() noexcept {
+    stopping_.store(true, std::memory_order_release);
+    work_seq_.fetch_add(1, std::memory_order_release);
+    futex_wake(work_seq_, INT_MAX);
+    for (auto& thread : threads_) thread.join();
+    threads_.clear();
+}
+
+inline void WorkStealingExecutor::run_(Worker& self) noexcept {
+    current_() = &self;
+    while (true) {
+        if (auto* const task = find_task_(self)) {
+            execute_(task);
+            continue;
+        }
+
+        auto const old = work_seq_.load(std::memory_order_acquire);
+        num_sleepers_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        // Looked for again once counted in, as a task submitted in between
+        // would not have woken this worker up
+        auto* const task     = find_task_(self);
+        auto const  stopping = stopping_.load(std::memory_order_acquire);
+        if (!task && !stopping) futex_wait(work_seq_, old);
+        num_sleepers_.fetch_sub(1, std::memory_order_relaxed);
+        if (task) {
+            execute_(task);
+        } else if (stopping) {
+            return;
+        }
+    }
+}
+
+}   // namespace dsa
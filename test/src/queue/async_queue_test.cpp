@@ -0,0 +1,218 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <coroutine>   // coroutine_handle<Promise>, suspend_never, ...
+#include <deque>       // deque<T>
+#include <exception>   // terminate()
+#include <memory>      // unique_ptr<T>, make_unique()
+#include <string>      // string
+#include <utility>     // exchange()
+#include <vector>      // vector<T>
+
+#include "async_queue.hpp"
+
+using IntAsyncQueue = dsa::AsyncQueue<int>;
+
+// Single-threaded event loop, which resumes the coroutines scheduled on it in
+// turn
+struct EventLoop
+{
+    std::deque<std::coroutine_handle<>> ready {};
+
+    // Awaitable that reschedules the awaiting coroutine at the end of the loop
+    struct Yield
+    {
+        EventLoop& loop;
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            loop.ready.push_back(handle);
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    Yield yield() noexcept { return Yield { *this }; }
+
+    void run() {
+        while (!ready.empty()) {
+            auto handle = ready.front();
+            ready.pop_front();
+            handle.resume();
+        }
+    }
+};
+
+// Coroutine that starts eagerly, and whose frame is destroyed with it
+struct Task
+{
+    struct promise_type
+    {
+        Task get_return_object() {
+            return Task { std::coroutine_handle<promise_type>::from_promise(
+                *this) };
+        }
+
+        std::suspend_never  initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void                return_void() noexcept {}
+        void                unhandled_exception() { std::terminate(); }
+    };
+
+    std::coroutine_handle<promise_type> handle;
+
+    explicit Task(std::coroutine_handle<promise_type> handle_)
+        : handle { handle_ } {}
+
+    Task(Task&& other) noexcept : handle { std::exchange(other.handle, {}) } {}
+
+    ~Task() {
+        if (handle) handle.destroy();
+    }
+
+    bool done() const { return handle.done(); }
+};
+
+// Pops `n` elements into `out`
+Task consume(IntAsyncQueue& q, int n, std::vector<int>& out) {
+    for (int i { 0 }; i < n; ++i) out.push_back(co_await q.pop());
+}
+
+/* --- CORNER CASES --- */
+
+// Peek front, dequeue when empty --> throw
+TEST(AsyncQueueTest, PeekFrontOrDequeueWhenEmptyFails) {
+    auto q = IntAsyncQueue();
+    EXPECT_TRUE(q.empty());
+    EXPECT_THROW(q.front(), dsa::EmptyQueueError);
+    EXPECT_THROW(q.dequeue(), dsa::EmptyQueueError);
+    EXPECT_EQ(q.num_waiters(), 0);
+}
+
+// Pop when not empty --> front element without suspending
+TEST(AsyncQueueTest, PopWhenNotEmptyDoesNotSuspend) {
+    auto q = IntAsyncQueue();
+    q.enqueue(1);
+    q.enqueue(2);
+    auto out  = std::vector<int> {};
+    auto task = consume(q, 2, out);
+    EXPECT_TRUE(task.done());
+    EXPECT_EQ(out, (std::vector<int> { 1, 2 }));
+    EXPECT_TRUE(q.empty());
+}
+
+// Destroy a consumer while it waits --> unlinked from the queue
+TEST(AsyncQueueTest, DestroyWaitingConsumerUnlinksIt) {
+    auto q     = IntAsyncQueue();
+    auto out   = std::vector<int> {};
+    auto task1 = std::make_unique<Task>(consume(q, 1, out));
+    auto task2 = consume(q, 1, out);
+    EXPECT_EQ(q.num_waiters(), 2);
+    task1.reset();
+    EXPECT_EQ(q.num_waiters(), 1);
+    q.enqueue(7);
+    EXPECT_TRUE(task2.done());
+    EXPECT_EQ(out, (std::vector<int> { 7 }));
+    EXPECT_TRUE(q.empty());
+}
+
+/* --- REGULAR CASES --- */
+
+// Pop when empty --> suspended until an element is added, which is handed
+// over rather than queued
+TEST(AsyncQueueTest, PopWhenEmptySuspendsUntilEnqueued) {
+    auto q    = dsa::AsyncQueue<std::string>();
+    auto out  = std::string {};
+    auto task = [](dsa::AsyncQueue<std::string>& q_,
+                   std::string&                  out_) -> Task {
+        out_ = co_await q_.pop();
+    }(q, out);
+    EXPECT_FALSE(task.done());
+    EXPECT_EQ(q.num_waiters(), 1);
+
+    q.emplace(3, 'a');
+    EXPECT_TRUE(task.done());
+    EXPECT_EQ(out, "aaa");
+    EXPECT_EQ(q.num_waiters(), 0);
+    EXPECT_TRUE(q.empty());
+}
+
+// Several consumers waiting --> resumed in the order they started waiting
+TEST(AsyncQueueTest, ResumesWaitingConsumersInOrder) {
+    auto q     = IntAsyncQueue();
+    auto out1  = std::vector<int> {};
+    auto out2  = std::vector<int> {};
+    auto task1 = consume(q, 2, out1);
+    auto task2 = consume(q, 1, out2);
+    q.enqueue(1);   // to task1, which waits again, after task2
+    q.enqueue(2);   // to task2
+    q.enqueue(3);   // to task1
+    q.enqueue(4);   // queued
+    EXPECT_TRUE(task1.done());
+    EXPECT_TRUE(task2.done());
+    EXPECT_EQ(out1, (std::vector<int> { 1, 3 }));
+    EXPECT_EQ(out2, (std::vector<int> { 2 }));
+    EXPECT_EQ(q.to_string(), "[4]");
+}
+
+// Producer and consumers interleaved by an event loop --> every element
+// received exactly once, in FIFO order
+TEST(AsyncQueueTest, TransfersBetweenCoroutinesOnEventLoop) {
+    constexpr int num_elems { 1000 };
+    auto          loop = EventLoop {};
+    auto          q    = IntAsyncQueue(2);
+
+    auto out      = std::vector<int> {};
+    auto consumer = [](EventLoop& loop_, IntAsyncQueue& q_,
+                       std::vector<int>& out_) -> Task {
+        for (int i { 0 }; i < num_elems; ++i) {
+            out_.push_back(co_await q_.pop());
+            if (i % 3 == 0) co_await loop_.yield();
+        }
+    }(loop, q, out);
+    auto producer = [](EventLoop& loop_, IntAsyncQueue& q_) -> Task {
+        for (int i { 0 }; i < num_elems; ++i) {
+            q_.enqueue(i);
+            if (i % 5 == 0) co_await loop_.yield();
+        }
+    }(loop, q);
+    loop.run();
+
+    EXPECT_TRUE(producer.done());
+    EXPECT_TRUE(consumer.done());
+    ASSERT_EQ(out.size(), num_elems);
+    for (int i { 0 }; i < num_elems; ++i) EXPECT_EQ(out[i], i);
+    EXPECT_TRUE(q.empty());
+}
@@ -0,0 +1,217 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>    // atomic<T>
+#include <chrono>    // steady_clock, milliseconds
+#include <cstddef>   // size_t
+#include <memory>    // unique_ptr<T>, make_unique()
+#include <string>    // string
+#include <thread>    // thread, this_thread::sleep_for()
+#include <vector>    // vector<T>
+
+#include "blocking_queue.hpp"
+#include "segmented_array_queue.hpp"
+
+using namespace std::chrono_literals;
+
+using IntBlockingQueue = dsa::BlockingQueue<int>;
+using SizeBlockingQueue =
+    dsa::BlockingQueue<std::size_t, dsa::SegmentedArrayQueue<std::size_t>>;
+
+/* --- CORNER CASES --- */
+
+// Peek front, dequeue when empty --> throw; try dequeue --> false
+TEST(BlockingQueueTest, PeekFrontOrDequeueWhenEmptyFails) {
+    auto q = IntBlockingQueue(4);
+    EXPECT_TRUE(q.empty());
+    EXPECT_THROW(q.front(), dsa::EmptyQueueError);
+    EXPECT_THROW(q.dequeue(), dsa::EmptyQueueError);
+    int out { -1 };
+    EXPECT_FALSE(q.try_dequeue(out));
+    EXPECT_EQ(out, -1);
+}
+
+// Enqueue when the wrapped queue is full --> throw
+TEST(BlockingQueueTest, EnqueueWhenFullFails) {
+    auto q = IntBlockingQueue(2);
+    q.enqueue(0);
+    q.emplace(1);
+    EXPECT_THROW(q.enqueue(2), dsa::FullQueueError);
+    EXPECT_EQ(q.to_string(), "[0 1]");
+}
+
+// Pop with a timeout when empty --> false after the timeout
+TEST(BlockingQueueTest, PopForTimesOutWhenEmpty) {
+    auto       q     = IntBlockingQueue(4);
+    auto const start = std::chrono::steady_clock::now();
+    int        out { -1 };
+    EXPECT_FALSE(q.pop_for(out, 20ms));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+    EXPECT_EQ(out, -1);
+}
+
+// Close while consumers wait --> every consumer woken, with nothing popped
+TEST(BlockingQueueTest, CloseWakesWaitingConsumers) {
+    auto q         = IntBlockingQueue(4);
+    auto num_woken = std::atomic<int> { 0 };
+    auto threads   = std::vector<std::thread> {};
+    for (int t { 0 }; t < 2; ++t) {
+        threads.emplace_back([&q, &num_woken] {
+            int out;
+            if (!q.pop_wait(out)) num_woken.fetch_add(1);
+        });
+    }
+    threads.emplace_back([&q, &num_woken] {
+        int out;
+        if (!q.pop_for(out, 1h)) num_woken.fetch_add(1);
+    });
+    std::this_thread::sleep_for(10ms);
+    q.close();
+    for (auto& thread : threads) thread.join();
+    EXPECT_EQ(num_woken.load(), 3);
+    EXPECT_TRUE(q.closed());
+}
+
+// Pop with the maximum timeout of any duration type --> waits until closed
+// instead of timing out at once on an overflowed deadline
+TEST(BlockingQueueTest, PopForMaxTimeoutDoesNotOverflow) {
+    auto q          = IntBlockingQueue(4);
+    auto num_done   = std::atomic<int> { 0 };
+    auto num_popped = std::atomic<int> { 0 };
+    auto pop_for    = [&q, &num_done, &num_popped](auto timeout) {
+        int out;
+        if (q.pop_for(out, timeout)) num_popped.fetch_add(1);
+        num_done.fetch_add(1);
+    };
+    auto threads = std::vector<std::thread> {};
+    threads.emplace_back(pop_for, std::chrono::nanoseconds::max());
+    threads.emplace_back(pop_for, std::chrono::hours::max());
+    threads.emplace_back(pop_for, std::chrono::duration<double>::max());
+    std::this_thread::sleep_for(20ms);
+    EXPECT_EQ(num_done.load(), 0);
+
+    EXPECT_TRUE(q.push_wait(7));
+    q.close();
+    for (auto& thread : threads) thread.join();
+    EXPECT_EQ(num_done.load(), 3);
+    EXPECT_EQ(num_popped.load(), 1);
+}
+
+// Close when not empty --> push fails, but the remaining elements are popped
+TEST(BlockingQueueTest, CloseLetsConsumersDrain) {
+    auto q = dsa::BlockingQueue<std::string>(4);
+    EXPECT_TRUE(q.push_wait("a"));
+    EXPECT_TRUE(q.push_wait(std::string { "b" }));
+    q.close();
+    q.close();
+
+    auto elem = std::string { "c" };
+    EXPECT_FALSE(q.push_wait(std::move(elem)));
+    EXPECT_EQ(elem, "c");
+
+    std::string out;
+    EXPECT_TRUE(q.pop_wait(out));
+    EXPECT_EQ(out, "a");
+    EXPECT_TRUE(q.pop_for(out, 1h));
+    EXPECT_EQ(out, "b");
+    EXPECT_FALSE(q.pop_wait(out));
+    EXPECT_FALSE(q.pop_for(out, 1h));
+}
+
+/* --- REGULAR CASES --- */
+
+// Pop while empty --> blocks until another thread pushes
+TEST(BlockingQueueTest, PopWaitBlocksUntilPushed) {
+    auto q      = IntBlockingQueue(4);
+    auto popped = std::atomic<bool> { false };
+    int  out { -1 };
+    auto consumer = std::thread { [&q, &popped, &out] {
+        popped.store(q.pop_wait(out));
+    } };
+    std::this_thread::sleep_for(10ms);
+    EXPECT_FALSE(popped.load());
+    EXPECT_TRUE(q.push_wait(42));
+    consumer.join();
+    EXPECT_TRUE(popped.load());
+    EXPECT_EQ(out, 42);
+    EXPECT_TRUE(q.empty());
+}
+
+// Push while full --> blocks until another thread pops
+TEST(BlockingQueueTest, PushWaitBlocksWhileFull) {
+    auto q = IntBlockingQueue(2);
+    EXPECT_TRUE(q.push_wait(0));
+    EXPECT_TRUE(q.push_wait(1));
+    auto pushed   = std::atomic<bool> { false };
+    auto producer = std::thread { [&q, &pushed] {
+        pushed.store(q.push_wait(2));
+    } };
+    std::this_thread::sleep_for(10ms);
+    EXPECT_FALSE(pushed.load());
+    q.dequeue();
+    producer.join();
+    EXPECT_TRUE(pushed.load());
+    EXPECT_EQ(q.to_string(), "[1 2]");
+}
+
+// Several producers and consumers on an unbounded queue until closed -->
+// every element received exactly once
+TEST(BlockingQueueTest, TransfersBetweenThreadsExactlyOnce) {
+    constexpr std::size_t num_threads { 4 };
+    constexpr std::size_t num_elems_per_producer { 1 << 12 };
+    constexpr std::size_t num_elems { num_threads * num_elems_per_producer };
+    auto q = std::make_unique<SizeBlockingQueue>();
+
+    auto seen      = std::vector<std::atomic<int>>(num_elems);
+    auto producers = std::vector<std::thread> {};
+    auto consumers = std::vector<std::thread> {};
+    for (std::size_t t { 0 }; t < num_threads; ++t) {
+        producers.emplace_back([&q, t] {
+            for (std::size_t i { 0 }; i < num_elems_per_producer; ++i) {
+                q->push_wait(t * num_elems_per_producer + i);
+            }
+        });
+        consumers.emplace_back([&q, &seen] {
+            for (std::size_t out; q->pop_wait(out);) seen[out].fetch_add(1);
+        });
+    }
+    for (auto& thread : producers) thread.join();
+    q->close();
+    for (auto& thread : consumers) thread.join();
+
+    std::size_t num_not_seen_once { 0 };
+    for (auto const& count : seen) num_not_seen_once += count.load() != 1;
+    EXPECT_EQ(num_not_seen_once, 0);
+    EXPECT_TRUE(q->empty());
+}
@@ -0,0 +1,174 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>      // atomic<T>
+#include <cstddef>     // size_t
+#include <memory>      // unique_ptr<T>, make_unique()
+#include <stdexcept>   // runtime_error
+#include <string>      // string
+#include <thread>      // thread, this_thread::yield()
+#include <vector>      // vector<T>
+
+#include "broadcast_ring.hpp"
+
+using IntBroadcastRing = dsa::BroadcastRing<int>;
+
+/* --- CORNER CASES --- */
+
+// Consume when nothing is published --> nothing consumed
+TEST(BroadcastRingTest, ConsumeWhenEmptyConsumesNothing) {
+    auto ring     = IntBroadcastRing(4);
+    auto consumer = ring.add_consumer();
+    EXPECT_EQ(ring.available(consumer), 0);
+    EXPECT_EQ(ring.consume(consumer, [](int) { FAIL(); }), 0);
+}
+
+// Publish ahead of the slowest consumer by the capacity --> false; a slot is
+// reused once every consumer has passed it
+TEST(BroadcastRingTest, PublishWhenSlowestConsumerIsBehindFails) {
+    auto ring = IntBroadcastRing(3);   // rounded up to 4
+    EXPECT_EQ(ring.capacity(), 4);
+    auto fast = ring.add_consumer();
+    auto slow = ring.add_consumer();
+    for (int i { 0 }; i < 4; ++i) EXPECT_TRUE(ring.try_publish(i));
+    EXPECT_FALSE(ring.try_publish(4));
+
+    EXPECT_EQ(ring.consume(fast, [](int) {}), 4);
+    EXPECT_FALSE(ring.try_emplace(4));
+    EXPECT_EQ(ring.consume(slow, [](int) {}, 1), 1);
+    EXPECT_TRUE(ring.try_emplace(4));
+    EXPECT_FALSE(ring.try_publish(5));
+}
+
+// Action throws --> elements before it consumed, the failing one kept
+TEST(BroadcastRingTest, ThrowingActionConsumesElementsBeforeIt) {
+    auto ring     = IntBroadcastRing(8);
+    auto consumer = ring.add_consumer();
+    for (int i { 0 }; i < 4; ++i) ring.try_publish(i);
+    EXPECT_THROW(ring.consume(consumer,
+                              [](int elem) {
+                                  if (elem == 2) {
+                                      throw std::runtime_error { "failed" };
+                                  }
+                              }),
+                 std::runtime_error);
+    EXPECT_EQ(ring.available(consumer), 2);
+    auto seen = std::vector<int> {};
+    ring.consume(consumer, [&seen](int elem) { seen.push_back(elem); });
+    EXPECT_EQ(seen, (std::vector<int> { 2, 3 }));
+}
+
+/* --- REGULAR CASES --- */
+
+// Several consumers --> each sees every element, in place and in order
+TEST(BroadcastRingTest, EveryConsumerSeesEveryElement) {
+    auto ring   = dsa::BroadcastRing<std::string>(4);
+    auto first  = ring.add_consumer();
+    auto second = ring.add_consumer();
+    for (auto const* word : { "a", "b", "c" }) ring.try_publish(word);
+
+    auto addrs = std::vector<std::string const*> {};
+    auto seen  = std::string {};
+    ring.consume(first, [&](std::string const& elem) {
+        addrs.push_back(&elem);
+        seen += elem;
+    });
+    EXPECT_EQ(seen, "abc");
+    std::size_t i { 0 };
+    ring.consume(second, [&](std::string const& elem) {
+        EXPECT_EQ(&elem, addrs[i++]);   // the same object, not a copy
+        seen += elem;
+    });
+    EXPECT_EQ(seen, "abcabc");
+}
+
+// Consumer depending on another --> only sees what the other has consumed
+TEST(BroadcastRingTest, DependentConsumerWaitsForDependency) {
+    auto ring      = IntBroadcastRing(8);
+    auto validator = ring.add_consumer();
+    auto persister = ring.add_consumer({ validator });
+    for (int i { 0 }; i < 5; ++i) ring.try_publish(i);
+    EXPECT_EQ(ring.available(validator), 5);
+    EXPECT_EQ(ring.available(persister), 0);
+
+    ring.consume(validator, [](int) {}, 3);
+    EXPECT_EQ(ring.available(persister), 3);
+    EXPECT_EQ(ring.consume(persister, [](int) {}), 3);
+    EXPECT_EQ(ring.available(persister), 0);
+}
+
+// Producer and consumer threads, one consumer depending on two others -->
+// every consumer sees every element in order, and the dependent consumer
+// only after both of its dependencies
+TEST(BroadcastRingTest, BroadcastsBetweenThreads) {
+    constexpr std::size_t num_elems { 1 << 16 };
+    auto ring = std::make_unique<dsa::BroadcastRing<std::size_t>>(64);
+
+    // Number of elements consumed by each consumer
+    auto counts     = std::vector<std::atomic<std::size_t>>(3);
+    auto logger     = ring->add_consumer();
+    auto metrics    = ring->add_consumer();
+    auto persister  = ring->add_consumer({ logger, metrics });
+    auto num_errors = std::atomic<std::size_t> { 0 };
+
+    auto run = [&](dsa::BroadcastRing<std::size_t>::Consumer consumer,
+                   std::size_t                                 id) {
+        return std::thread { [&, consumer, id] {
+            auto& count = counts[id];
+            while (count.load() < num_elems) {
+                auto const n = ring->consume(consumer, [&](std::size_t elem) {
+                    if (elem != count.load()) num_errors.fetch_add(1);
+                    if (id == 2 && (counts[0].load() <= elem
+                                    || counts[1].load() <= elem)) {
+                        num_errors.fetch_add(1);
+                    }
+                    count.fetch_add(1);
+                });
+                if (n == 0) std::this_thread::yield();
+            }
+        } };
+    };
+    auto threads = std::vector<std::thread> {};
+    threads.push_back(run(logger, 0));
+    threads.push_back(run(metrics, 1));
+    threads.push_back(run(persister, 2));
+    for (std::size_t i { 0 }; i < num_elems;) {
+        if (ring->try_publish(i)) ++i;
+        else std::this_thread::yield();
+    }
+    for (auto& thread : threads) thread.join();
+
+    EXPECT_EQ(num_errors.load(), 0);
+    for (auto const& count : counts) EXPECT_EQ(count.load(), num_elems);
+}
@@ -0,0 +1,311 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <array>             // array<T, N>
+#include <cstddef>           // size_t, byte
+#include <memory>            // shared_ptr<T>, make_shared()
+#include <memory_resource>   // pmr::monotonic_buffer_resource, ...
+#include <new>               // bad_alloc
+#include <ostream>           // ostream
+#include <stdexcept>         // runtime_error
+#include <string>            // string, pmr::string
+#include <utility>           // move()
+
+#include "chunked_list_queue.hpp"
+
+// Small chunks, so that tests cross chunk boundaries
+using IntChunkedListQueue = dsa::ChunkedListQueue<int, 4>;
+
+// Element type that counts how many of its kind are constructed, by any
+// constructor
+struct Built
+{
+    static inline int num_built { 0 };
+
+    int value;
+
+    Built(int v) : value { v } { ++num_built; }
+    Built(Built const& other) : value { other.value } { ++num_built; }
+    Built(Built&& other) noexcept : value { other.value } { ++num_built; }
+
+    friend std::ostream& operator<<(std::ostream& os, Built const& c) {
+        return os << c.value;
+    }
+};
+
+/* --- CORNER CASES --- */
+
+// Peek front, dequeue when empty --> throw
+TEST(ChunkedListQueueTest, PeekFrontOrDequeueWhenEmptyFails) {
+    auto q = IntChunkedListQueue();
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(q.size(), 0);
+    EXPECT_THROW(q.front(), dsa::EmptyQueueError);
+    EXPECT_THROW(q.dequeue(), dsa::EmptyQueueError);
+    EXPECT_EQ(q.to_string(), "[]");
+}
+
+// Element constructor throws, also into a new chunk --> queue unchanged and
+// still usable
+TEST(ChunkedListQueueTest, ThrowingConstructorLeavesQueueUnchanged) {
+    struct Fragile
+    {
+        int value;
+
+        Fragile(int value_, bool fail = false) : value { value_ } {
+            if (fail) throw std::runtime_error { "construction failed" };
+        }
+    };
+
+    auto q = dsa::ChunkedListQueue<Fragile, 2>();
+    EXPECT_THROW(q.emplace(0, true), std::runtime_error);
+    q.emplace(1);
+    EXPECT_THROW(q.emplace(2, true), std::runtime_error);
+    q.emplace(3);
+    EXPECT_THROW(q.emplace(4, true), std::runtime_error);
+    q.emplace(5);
+
+    EXPECT_EQ(q.size(), 3);
+    for (int expected : { 1, 3, 5 }) {
+        EXPECT_EQ(q.front().value, expected);
+        q.dequeue();
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+/* --- REGULAR CASES --- */
+
+// Enqueue across several chunks, dequeue --> elements in FIFO order
+TEST(ChunkedListQueueTest, PreservesOrderAcrossChunks) {
+    auto q = dsa::ChunkedListQueue<std::string, 4>();
+    for (auto const* word : { "a", "b", "c", "d", "e", "f" }) q.enqueue(word);
+    auto word = std::string { "g" };
+    q.enqueue(std::move(word));
+    q.emplace(1, 'h');
+    q.emplace(1, 'i');
+    EXPECT_EQ(q.size(), 9);
+    EXPECT_FALSE(q.empty());
+    EXPECT_EQ(q.front(), "a");
+    EXPECT_EQ(q.to_string(), "[a b c d e f g h i]");
+
+    q.front() = "z";
+    EXPECT_EQ(q.to_string(), "[z b c d e f g h i]");
+    for (int i { 0 }; i < 5; ++i) q.dequeue();
+    EXPECT_EQ(q.front(), "f");
+    EXPECT_EQ(q.to_string(), "[f g h i]");
+}
+
+// Fill and drain repeatedly --> elements in FIFO order as chunks recycle
+TEST(ChunkedListQueueTest, FillAndDrainRepeatedly) {
+    auto q = IntChunkedListQueue();
+    for (int round { 0 }; round < 100; ++round) {
+        for (int i { 0 }; i < 10; ++i) q.enqueue(round * 10 + i);
+        for (int i { 0 }; i < 10; ++i) {
+            EXPECT_EQ(q.front(), round * 10 + i);
+            q.dequeue();
+        }
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+// Drain a chunk while elements are added at the same rate --> the drained
+// chunk reused for the next chunk
+TEST(ChunkedListQueueTest, ReusesDrainedChunk) {
+    auto q = IntChunkedListQueue();
+    for (int i { 0 }; i < 5; ++i) q.enqueue(i);
+    auto const* first = &q.front();
+    for (int i { 0 }; i < 4; ++i) q.dequeue();
+    for (int i { 5 }; i < 9; ++i) q.enqueue(i);
+    for (int i { 0 }; i < 4; ++i) q.dequeue();
+    EXPECT_EQ(&q.front(), first);
+    EXPECT_EQ(q.front(), 8);
+
+    // Drain completely --> the only chunk rewound
+    q.dequeue();
+    q.enqueue(9);
+    EXPECT_EQ(&q.front(), first);
+}
+
+// Splice after a partial chunk, before a partial chunk --> chunks linked in
+// place, no element constructed or moved; splice into empty queue --> chunks
+// swapped
+TEST(ChunkedListQueueTest, SpliceLinksChunksOrMovesElements) {
+    using BuiltQueue = dsa::ChunkedListQueue<Built, 4>;
+    auto q           = BuiltQueue();
+    auto other       = BuiltQueue();
+    for (int i { 0 }; i < 6; ++i) q.emplace(i);   // last chunk half full
+    for (int i { 6 }; i < 13; ++i) other.emplace(i);
+    other.dequeue();   // first chunk starts with its second slot
+    auto const* linked    = &other.front();
+    auto const  num_built = Built::num_built;
+
+    q.splice(other);
+    EXPECT_EQ(Built::num_built, num_built);
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(q.size(), 12);
+    EXPECT_EQ(q.to_string(), "[0 1 2 3 4 5 7 8 9 10 11 12]");
+    q.emplace(13);
+    for (int i { 0 }; i < 6; ++i) q.dequeue();
+    EXPECT_EQ(&q.front(), linked);
+    EXPECT_EQ(q.to_string(), "[7 8 9 10 11 12 13]");
+
+    auto empty = BuiltQueue();
+    empty.splice(q);
+    EXPECT_EQ(Built::num_built, num_built + 1);
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(&empty.front(), linked);
+    EXPECT_EQ(empty.to_string(), "[7 8 9 10 11 12 13]");
+}
+
+// Splice across memory resources --> elements moved one by one
+TEST(ChunkedListQueueTest, SpliceAcrossResourcesMovesElements) {
+    using PmrQueue = dsa::pmr::ChunkedListQueue<int, 4>;
+
+    auto res1  = std::pmr::monotonic_buffer_resource {};
+    auto res2  = std::pmr::monotonic_buffer_resource {};
+    auto q     = PmrQueue(&res1);
+    auto other = PmrQueue(&res2);
+    for (int i { 0 }; i < 3; ++i) q.enqueue(i);
+    for (int i { 3 }; i < 9; ++i) other.enqueue(i);
+    auto const* moved = &other.front();
+
+    q.splice(other);
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(q.to_string(), "[0 1 2 3 4 5 6 7 8]");
+    for (int i { 0 }; i < 3; ++i) q.dequeue();
+    EXPECT_NE(&q.front(), moved);
+}
+
+// Copy, then modify either queue --> the other unchanged
+TEST(ChunkedListQueueTest, CopiesAreIndependent) {
+    auto q = IntChunkedListQueue();
+    for (int i { 0 }; i < 7; ++i) q.enqueue(i);
+    q.dequeue();
+
+    auto copy = q;
+    EXPECT_EQ(copy.to_string(), "[1 2 3 4 5 6]");
+    copy.enqueue(7);
+    q.dequeue();
+    EXPECT_EQ(copy.to_string(), "[1 2 3 4 5 6 7]");
+    EXPECT_EQ(q.to_string(), "[2 3 4 5 6]");
+
+    copy = q;
+    EXPECT_EQ(copy.to_string(), "[2 3 4 5 6]");
+}
+
+// Move construct, move assign --> elements moved, source left empty
+TEST(ChunkedListQueueTest, MovesElementsAndLeavesSourceEmpty) {
+    auto q = IntChunkedListQueue();
+    for (int i { 0 }; i < 6; ++i) q.enqueue(i);
+
+    auto moved = std::move(q);
+    EXPECT_EQ(moved.to_string(), "[0 1 2 3 4 5]");
+    EXPECT_TRUE(q.empty());   // NOLINT(bugprone-use-after-move)
+
+    q.enqueue(9);
+    EXPECT_EQ(q.to_string(), "[9]");
+    q = std::move(moved);
+    EXPECT_EQ(q.to_string(), "[0 1 2 3 4 5]");
+    EXPECT_TRUE(moved.empty());   // NOLINT(bugprone-use-after-move)
+}
+
+// Elements left in queue --> destroyed with the queue
+TEST(ChunkedListQueueTest, DestroysRemainingElements) {
+    auto elem = std::make_shared<int>(42);
+    {
+        auto q = dsa::ChunkedListQueue<std::shared_ptr<int>, 4>();
+        for (int i { 0 }; i < 9; ++i) q.enqueue(elem);
+        for (int i { 0 }; i < 5; ++i) q.dequeue();
+        EXPECT_EQ(elem.use_count(), 5);
+
+        auto copy = q;
+        EXPECT_EQ(elem.use_count(), 9);
+        copy = dsa::ChunkedListQueue<std::shared_ptr<int>, 4>();
+        EXPECT_EQ(elem.use_count(), 5);
+    }
+    EXPECT_EQ(elem.use_count(), 1);
+}
+
+// Queue on a memory resource --> memory and elements allocated from it
+TEST(ChunkedListQueueTest, AllocatesFromMemoryResource) {
+    auto buf = std::array<std::byte, 8192> {};
+    auto res = std::pmr::monotonic_buffer_resource {
+        buf.data(), buf.size(), std::pmr::null_memory_resource()
+    };
+    auto q = dsa::pmr::ChunkedListQueue<std::pmr::string>(&res);
+    for (char c : { 'a', 'b', 'c' }) q.emplace(40, c);
+    EXPECT_EQ(q.get_allocator().resource(), &res);
+    EXPECT_EQ(q.front().get_allocator().resource(), &res);
+    EXPECT_EQ(q.front(), std::pmr::string(40, 'a'));
+
+    // Resource exhausted --> throw, queue unchanged
+    std::size_t n { 0 };
+    EXPECT_THROW(
+        {
+            for (;; ++n) q.emplace(40, 'z');
+        },
+        std::bad_alloc);
+    EXPECT_EQ(q.size(), 3 + n);
+    q.dequeue();
+    EXPECT_EQ(q.front(), std::pmr::string(40, 'b'));
+}
+
+// Copy --> default resource; assign --> resource kept, elements copied or
+// moved one by one
+TEST(ChunkedListQueueTest, PropagatesAllocatorAsDirected) {
+    using PmrQueue = dsa::pmr::ChunkedListQueue<int>;
+
+    auto res1 = std::pmr::monotonic_buffer_resource {};
+    auto res2 = std::pmr::monotonic_buffer_resource {};
+    auto q1   = PmrQueue(&res1);
+    for (int i { 1 }; i <= 3; ++i) q1.enqueue(i);
+
+    auto copy = q1;
+    EXPECT_EQ(copy.get_allocator().resource(),
+              std::pmr::get_default_resource());
+    EXPECT_EQ(copy.to_string(), "[1 2 3]");
+
+    auto q2 = PmrQueue(&res2);
+    q2      = q1;
+    EXPECT_EQ(q2.get_allocator().resource(), &res2);
+    EXPECT_EQ(q2.to_string(), "[1 2 3]");
+
+    auto moved = std::move(q1);
+    EXPECT_EQ(moved.get_allocator().resource(), &res1);
+    q2.dequeue();
+    q2 = std::move(moved);
+    EXPECT_EQ(q2.get_allocator().resource(), &res2);
+    EXPECT_EQ(q2.to_string(), "[1 2 3]");
+    EXPECT_TRUE(moved.empty());   // NOLINT(bugprone-use-after-move)
+}
@@ -32,9 +32,68 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <gtest/gtest.h>
 
+#include <array>             // array<T, N>
+#include <cstddef>           // byte
+#include <functional>        // less<T>
+#include <iterator>          // back_inserter(), istream_iterator<T>
+#include <list>              // list<T>
+#include <memory_resource>   // pmr::monotonic_buffer_resource, ...
+#include <new>               // bad_alloc
+#include <span>              // span<T>
+#include <sstream>           // istringstream
+#include <stdexcept>         // logic_error
+#include <string>            // string, pmr::string
+#include <vector>            // vector<T>
+
+#include "algos.hpp"
 #include "circ_array_queue.hpp"
 
 using IntCircArrayQueue = dsa::CircArrayQueue<int>;
+using IntPow2CircArrayQueue =
+    dsa::CircArrayQueue<int, dsa::PowerOfTwoCapacity>;
+using PmrIntCircArrayQueue = dsa::pmr::CircArrayQueue<int>;
+
+// Memory resource that counts the allocations it passes on to the free store
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    std::size_t num_allocs { 0 };
+
+private:
+    void* do_allocate(std::size_t n, std::size_t align) override {
+        ++num_allocs;
+        return std::pmr::new_delete_resource()->allocate(n, align);
+    }
+    void do_deallocate(void* p, std::size_t n, std::size_t align) override {
+        std::pmr::new_delete_resource()->deallocate(p, n, align);
+    }
+    bool do_is_equal(
+        std::pmr::memory_resource const& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Element type that has no default ctor and keeps track of its instances
+struct Tracked
+{
+    static inline int live { 0 };
+    static inline int copies_or_moves { 0 };
+
+    std::string name;
+
+    Tracked(std::string nm, int n) : name { nm + std::to_string(n) } {
+        ++live;
+    }
+    Tracked(Tracked const& other) : name { other.name } {
+        ++live;
+        ++copies_or_moves;
+    }
+    Tracked(Tracked&& other) noexcept : name { std::move(other.name) } {
+        ++live;
+        ++copies_or_moves;
+    }
+    ~Tracked() { --live; }
+};
 
 /* --- CORNER CASES --- */
 
@@ -149,4 +208,539 @@ TEST(CircArrayQueueTest, NonconstFrontReturnValueIsMutable) {
     EXPECT_EQ(elem, 3);
     elem = 2;
     EXPECT_EQ(q.front(), 2);
-}
\ No newline at end of file
+}
+
+/* --- POWER-OF-TWO CAPACITY MODE --- */
+
+// Initial capacity --> rounded up to a power of two
+TEST(CircArrayQueueTest, PowerOfTwoModeRoundsUpCapacity) {
+    EXPECT_EQ(IntPow2CircArrayQueue(0).capacity(), 1);
+    EXPECT_EQ(IntPow2CircArrayQueue(1).capacity(), 1);
+    EXPECT_EQ(IntPow2CircArrayQueue(5).capacity(), 8);
+    EXPECT_EQ(IntPow2CircArrayQueue(8).capacity(), 8);
+
+    auto q = IntPow2CircArrayQueue(3);
+    for (int i { 0 }; i < 5; ++i) q.enqueue(i);
+    EXPECT_EQ(q.capacity(), 8);
+}
+
+// Enqueue, dequeue across the end of the array --> elements stay in order
+TEST(CircArrayQueueTest, PowerOfTwoModeWrapsAround) {
+    auto q = IntPow2CircArrayQueue(4);
+    int  next_in { 0 }, next_out { 0 };
+    for (int round { 0 }; round < 10; ++round) {
+        q.enqueue(next_in++);
+        q.enqueue(next_in++);
+        q.enqueue(next_in++);
+        EXPECT_EQ(q.front(), next_out++);
+        q.dequeue();
+        EXPECT_EQ(q.front(), next_out++);
+        q.dequeue();
+    }
+    EXPECT_EQ(q.size(), 10);
+    q.iter([&next_out](int const& num) { EXPECT_EQ(num, next_out++); });
+    EXPECT_EQ(next_out, next_in);
+}
+
+/* --- SLOT STORAGE --- */
+
+// Create queue --> no element constructed
+TEST(CircArrayQueueTest, CreateConstructsNoElements) {
+    Tracked::live = 0;
+    auto q        = dsa::CircArrayQueue<Tracked>(64);
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+// Create, copy, merge empty queues --> no allocation until first enqueue
+TEST(CircArrayQueueTest, AllocationDeferredUntilFirstEnqueue) {
+    auto res  = CountingResource {};
+    auto q    = PmrIntCircArrayQueue(&res);
+    auto copy = PmrIntCircArrayQueue(q, &res);
+    EXPECT_EQ(res.num_allocs, 0);
+    EXPECT_EQ(q.capacity(), 4096);
+
+    q.enqueue(3);
+    EXPECT_EQ(res.num_allocs, 1);
+    EXPECT_EQ(q.capacity(), 4096);
+
+    copy.enqueue_span(std::span<int const> {});
+    EXPECT_EQ(res.num_allocs, 1);
+    copy.shrink_to_fit();
+    EXPECT_EQ(res.num_allocs, 1);
+    EXPECT_EQ(copy.capacity(), 1);
+    copy.enqueue(1);
+    copy.enqueue(4);
+    EXPECT_EQ(copy.to_string(), "[1 4]");
+}
+
+// Emplace --> constructed in its slot; dequeue --> destroyed right away
+TEST(CircArrayQueueTest, EmplaceConstructsInPlaceAndDequeueDestroys) {
+    Tracked::live            = 0;
+    Tracked::copies_or_moves = 0;
+    {
+        auto q = dsa::CircArrayQueue<Tracked>(4);
+        q.emplace("job", 1);
+        q.emplace("job", 2);
+        EXPECT_EQ(Tracked::live, 2);
+        EXPECT_EQ(Tracked::copies_or_moves, 0);
+        EXPECT_EQ(q.front().name, "job1");
+        q.dequeue();
+        EXPECT_EQ(Tracked::live, 1);
+        EXPECT_EQ(q.front().name, "job2");
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+// Copy a queue whose elements wrap around --> same elements in same order
+TEST(CircArrayQueueTest, CopyPreservesOrderAfterWrapAround) {
+    auto q = IntCircArrayQueue(4);
+    for (int num : { 1, 2, 3, 4 }) q.enqueue(num);
+    q.dequeue();
+    q.dequeue();
+    q.enqueue(5);   // wraps around to the start of the array
+
+    auto copy = q;
+    EXPECT_EQ(copy.to_string(), "[3 4 5]");
+
+    auto other = IntCircArrayQueue(2);
+    other      = q;
+    EXPECT_EQ(other.to_string(), "[3 4 5]");
+    EXPECT_EQ(q.to_string(), "[3 4 5]");
+}
+
+/* --- BULK OPERATIONS --- */
+
+// Enqueue contiguous range across the end of the array --> two segments
+TEST(CircArrayQueueTest, EnqueueRangeWrapsAroundAndGrowsOnce) {
+    auto q = IntCircArrayQueue(4);
+    q.enqueue(0);
+    q.enqueue(0);
+    q.dequeue();
+    q.dequeue();   // start index now at 2
+
+    std::vector<int> nums { 1, 2, 3 };
+    q.enqueue_range(nums.begin(), nums.end());
+    EXPECT_EQ(q.capacity(), 4);
+    EXPECT_EQ(q.to_string(), "[1 2 3]");
+
+    int more[] { 4, 5, 6, 7, 8, 9 };
+    q.enqueue_span(std::span<int const> { more });
+    EXPECT_EQ(q.capacity(), 16);
+    EXPECT_EQ(q.to_string(), "[1 2 3 4 5 6 7 8 9]");
+}
+
+// Enqueue non-contiguous and single-pass ranges --> elements in order
+TEST(CircArrayQueueTest, EnqueueRangeAcceptsAnyInputRange) {
+    auto words = std::list<std::string> { "a", "b", "c" };
+    auto q     = dsa::CircArrayQueue<std::string>(2);
+    q.enqueue_range(words.begin(), words.end());
+    EXPECT_EQ(q.to_string(), "[a b c]");
+
+    auto is = std::istringstream { "3 1 4 1 5" };
+    auto p  = IntCircArrayQueue(2);
+    p.enqueue_range(std::istream_iterator<int> { is },
+                    std::istream_iterator<int> {});
+    EXPECT_EQ(p.to_string(), "[3 1 4 1 5]");
+}
+
+// Dequeue n across the end of the array --> two segments in queue order
+TEST(CircArrayQueueTest, DequeueNWritesOutElementsInOrder) {
+    auto q = IntCircArrayQueue(8);
+    for (int num : { 0, 0, 0, 0, 0, 0 }) q.enqueue(num);
+    for (int i { 0 }; i < 6; ++i) q.dequeue();
+    for (int num : { 1, 2, 3, 4, 5 }) q.enqueue(num);   // wraps around
+
+    int  out[3] {};
+    auto end = q.dequeue_n(3, out);
+    EXPECT_EQ(end, out + 3);
+    EXPECT_EQ(out[0], 1);
+    EXPECT_EQ(out[1], 2);
+    EXPECT_EQ(out[2], 3);
+    EXPECT_EQ(q.to_string(), "[4 5]");
+
+    auto words = dsa::CircArrayQueue<std::string>(2);
+    for (auto const* word : { "x", "y", "z" }) words.enqueue(word);
+    auto rest = std::vector<std::string> {};
+    words.dequeue_n(2, std::back_inserter(rest));
+    EXPECT_EQ(rest, (std::vector<std::string> { "x", "y" }));
+    EXPECT_EQ(words.front(), "z");
+}
+
+// Dequeue more than size --> throw, nothing removed
+TEST(CircArrayQueueTest, DequeueNMoreThanSizeThrows) {
+    auto q = IntCircArrayQueue(4);
+    q.enqueue(3);
+    q.enqueue(1);
+    int out[3] {};
+    EXPECT_THROW(q.dequeue_n(3, out), dsa::EmptyQueueError);
+    EXPECT_EQ(q.size(), 2);
+}
+
+// Splice wrapped-around queue into wrapped-around queue --> grown once,
+// elements moved in order, other queue empty but keeps its array
+TEST(CircArrayQueueTest, SpliceMovesSegmentsAndGrowsOnce) {
+    auto q     = dsa::CircArrayQueue<Tracked>(4);
+    auto other = dsa::CircArrayQueue<Tracked>(4);
+    for (int i { 0 }; i < 3; ++i) {
+        q.emplace("a", i);
+        other.emplace("b", i);
+    }
+    q.dequeue();
+    other.dequeue();
+    q.emplace("a", 3);
+    q.emplace("a", 4);   // wraps around
+    other.emplace("b", 3);
+    other.emplace("b", 4);   // wraps around
+
+    Tracked::copies_or_moves = 0;
+    q.splice(other);
+    EXPECT_EQ(q.capacity(), 8);
+    EXPECT_EQ(Tracked::copies_or_moves, 8);   // 4 on growth, 4 spliced
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(other.capacity(), 4);
+    EXPECT_EQ(Tracked::live, 8);
+
+    auto names = std::string {};
+    q.iter([&names](Tracked const& elem) { names += elem.name; });
+    EXPECT_EQ(names, "a1a2a3a4b1b2b3b4");
+
+    q.splice(q);
+    EXPECT_EQ(q.size(), 8);
+}
+
+// Splice into empty queue --> arrays swapped, nothing moved or allocated
+TEST(CircArrayQueueTest, SpliceIntoEmptyQueueSwapsArrays) {
+    auto res   = CountingResource {};
+    auto q     = PmrIntCircArrayQueue(8, &res);
+    auto other = PmrIntCircArrayQueue(4, &res);
+    q.enqueue(0);
+    q.dequeue();
+    for (int i { 1 }; i <= 3; ++i) other.enqueue(i);
+    auto const* elems = other.segments()[0].data();
+    auto const  cap   = q.capacity();
+
+    auto const allocs = res.num_allocs;
+    q.splice(other);
+    EXPECT_EQ(res.num_allocs, allocs);
+    EXPECT_EQ(q.segments()[0].data(), elems);
+    EXPECT_EQ(q.capacity(), 4);
+    EXPECT_EQ(q.to_string(), "[1 2 3]");
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(other.capacity(), cap);
+
+    // Capacity reserved by this queue --> elements moved instead
+    auto r = PmrIntCircArrayQueue(4, &res);
+    r.reserve(16);
+    r.splice(q);
+    EXPECT_EQ(r.capacity(), 16);
+    EXPECT_EQ(r.to_string(), "[1 2 3]");
+}
+
+/* --- RESIZING --- */
+
+// Element type that can be copied but not moved
+struct CopyOnly
+{
+    int num;
+
+    CopyOnly(int n) : num { n } {}
+    CopyOnly(CopyOnly const& other) : num { other.num } {}
+    CopyOnly(CopyOnly&&) = delete;
+};
+
+// Trivially copyable element type large enough for few elements to take up
+// pages mapped from the OS
+struct Page
+{
+    int  num;
+    char payload[4092];
+};
+
+// Grow, shrink a wrapped queue of nothrow-movable type --> moved in order
+TEST(CircArrayQueueTest, ResizeMovesElementsInOrder) {
+    Tracked::live = 0;
+    {
+        auto q = dsa::CircArrayQueue<Tracked>(4);
+        for (int i { 0 }; i < 4; ++i) q.emplace("job", i);
+        q.dequeue();
+        q.dequeue();
+        q.emplace("job", 4);
+        q.emplace("job", 5);   // wraps around
+
+        Tracked::copies_or_moves = 0;
+        q.emplace("job", 6);
+        EXPECT_EQ(q.capacity(), 8);
+        EXPECT_EQ(Tracked::copies_or_moves, 4);
+        EXPECT_EQ(Tracked::live, 5);
+
+        for (int i { 2 }; i < 6; ++i) {
+            EXPECT_EQ(q.front().name, "job" + std::to_string(i));
+            q.dequeue();
+        }
+        EXPECT_EQ(q.capacity(), 4);
+        EXPECT_EQ(Tracked::live, 1);
+        EXPECT_EQ(q.front().name, "job6");
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+// Grow a wrapped queue of copy-only type --> copied in order
+TEST(CircArrayQueueTest, ResizeCopiesElementsWhenNotMovable) {
+    auto q = dsa::CircArrayQueue<CopyOnly>(2);
+    q.emplace(1);
+    q.emplace(2);
+    q.dequeue();
+    q.emplace(3);   // wraps around
+    q.emplace(4);
+    EXPECT_EQ(q.capacity(), 4);
+
+    int expected { 2 };
+    q.iter([&expected](CopyOnly const& elem) {
+        EXPECT_EQ(elem.num, expected++);
+    });
+    EXPECT_EQ(expected, 5);
+}
+
+// Grow a huge wrapped queue, either segment the shorter --> elements in order
+TEST(CircArrayQueueTest, ResizeHugeTriviallyCopyableQueueKeepsOrder) {
+    constexpr int cap { 4096 };   // 16 MiB of pages
+
+    for (int num_wrapped : { 1, cap - 1 }) {
+        auto q = dsa::CircArrayQueue<Page>(cap);
+        for (int i { 0 }; i < cap; ++i) q.enqueue(Page { i, {} });
+        for (int i { 0 }; i < num_wrapped; ++i) q.dequeue();
+        for (int i { cap }; i < cap + num_wrapped; ++i) {
+            q.enqueue(Page { i, {} });   // wraps around
+        }
+        EXPECT_EQ(q.capacity(), cap);
+
+        q.enqueue(Page { cap + num_wrapped, {} });
+        EXPECT_EQ(q.capacity(), 2 * cap);
+
+        int expected { num_wrapped };
+        q.iter([&expected](Page const& page) {
+            EXPECT_EQ(page.num, expected++);
+        });
+        EXPECT_EQ(expected, cap + num_wrapped + 1);
+    }
+}
+
+/* --- RESIZING POLICY --- */
+
+// Custom growth factor, shrink divisor, minimum capacity --> all honored
+TEST(CircArrayQueueTest, GeometricResizingHonorsParameters) {
+    auto q = dsa::CircArrayQueue<int, dsa::ExactCapacity,
+                                 dsa::GeometricResizing<3, 9, 4>>(1);
+    EXPECT_EQ(q.capacity(), 4);
+    for (int i { 0 }; i < 5; ++i) q.enqueue(i);
+    EXPECT_EQ(q.capacity(), 12);
+    for (int i { 0 }; i < 13; ++i) q.enqueue(i);
+    EXPECT_EQ(q.capacity(), 36);
+
+    while (q.size() > 4) q.dequeue();
+    EXPECT_EQ(q.capacity(), 36);
+    q.dequeue();   // 3 * 9 < 36
+    EXPECT_EQ(q.capacity(), 12);
+    while (!q.empty()) q.dequeue();
+    EXPECT_EQ(q.capacity(), 4);
+}
+
+// Never-shrink policy --> capacity kept when emptied
+TEST(CircArrayQueueTest, NeverShrinkKeepsCapacity) {
+    auto q = dsa::CircArrayQueue<int, dsa::PowerOfTwoCapacity,
+                                 dsa::NeverShrink<>>(2);
+    for (int i { 0 }; i < 9; ++i) q.enqueue(i);
+    EXPECT_EQ(q.capacity(), 16);
+    while (!q.empty()) q.dequeue();
+    EXPECT_EQ(q.capacity(), 16);
+}
+
+// Reserve --> no shrinking below it until shrink to fit
+TEST(CircArrayQueueTest, ReserveAndShrinkToFit) {
+    auto q = IntCircArrayQueue(2);
+    q.reserve(100);
+    EXPECT_EQ(q.capacity(), 100);
+    q.reserve(10);
+    EXPECT_EQ(q.capacity(), 100);
+
+    for (int i { 0 }; i < 100; ++i) q.enqueue(i);
+    EXPECT_EQ(q.capacity(), 100);
+    while (q.size() > 3) q.dequeue();
+    EXPECT_EQ(q.capacity(), 100);
+
+    q.shrink_to_fit();
+    EXPECT_EQ(q.capacity(), 3);
+    EXPECT_EQ(q.to_string(), "[97 98 99]");
+    while (!q.empty()) q.dequeue();
+    EXPECT_EQ(q.capacity(), 1);
+}
+
+// Reserve within the deferred capacity --> allocated now, not on enqueue
+TEST(CircArrayQueueTest, ReserveAllocatesDeferredArray) {
+    auto res = CountingResource {};
+    auto q   = PmrIntCircArrayQueue(&res);
+    q.reserve(0);
+    EXPECT_EQ(res.num_allocs, 0);
+    q.reserve(100);
+    EXPECT_EQ(res.num_allocs, 1);
+    EXPECT_EQ(q.capacity(), 4096);
+
+    q.enqueue(1);
+    q.enqueue_span(std::span<int const> { std::array { 2, 3 } });
+    EXPECT_EQ(res.num_allocs, 1);
+    EXPECT_EQ(q.to_string(), "[1 2 3]");
+}
+
+/* --- SEGMENTS VIEW --- */
+
+// View empty, contiguous, wrapped queue --> up to two segments in order
+TEST(CircArrayQueueTest, SegmentsViewElementsInPlace) {
+    auto q = IntCircArrayQueue(4);
+    auto [s1, s2] = q.segments();
+    EXPECT_TRUE(s1.empty());
+    EXPECT_TRUE(s2.empty());
+
+    for (int num : { 1, 2, 3 }) q.enqueue(num);
+    auto [t1, t2] = q.segments();
+    EXPECT_EQ(std::vector<int>(t1.begin(), t1.end()),
+              (std::vector<int> { 1, 2, 3 }));
+    EXPECT_TRUE(t2.empty());
+    EXPECT_EQ(t1.data(), &q.front());
+
+    q.dequeue();
+    q.dequeue();
+    for (int num : { 4, 5 }) q.enqueue(num);   // wraps around
+    auto [u1, u2] = q.segments();
+    EXPECT_EQ(std::vector<int>(u1.begin(), u1.end()),
+              (std::vector<int> { 3, 4 }));
+    EXPECT_EQ(std::vector<int>(u2.begin(), u2.end()),
+              (std::vector<int> { 5 }));
+}
+
+/* --- RESERVE/COMMIT --- */
+
+// Prepare across the end of the array, write, commit --> elements added
+TEST(CircArrayQueueTest, PrepareAndCommitWriteInPlace) {
+    auto q = dsa::CircArrayQueue<char>(8);
+    q.reserve(8);   // won't shrink as elements are dequeued
+    for (char c : { 'x', 'x', 'x', 'x', 'x', 'a' }) q.enqueue(c);
+    for (int i { 0 }; i < 5; ++i) q.dequeue();
+
+    auto [s1, s2] = q.prepare(5);
+    EXPECT_EQ(s1.size() + s2.size(), 5);
+    EXPECT_EQ(s1.size(), 2);
+    std::string const msg { "bcdef" };
+    std::copy_n(msg.begin(), s1.size(), s1.begin());
+    std::copy_n(msg.begin() + s1.size(), s2.size(), s2.begin());
+    EXPECT_EQ(q.size(), 1);
+
+    q.commit(4);
+    EXPECT_EQ(q.to_string("", ""), "[abcde]");
+
+    auto [t1, t2] = q.prepare(10);   // grows
+    EXPECT_EQ(t1.size() + t2.size(), 10);
+    EXPECT_GE(q.capacity(), 15);
+    t1[0] = 'z';
+    q.commit(1);
+    EXPECT_EQ(q.to_string("", ""), "[abcdez]");
+
+    EXPECT_THROW(q.commit(q.capacity()), std::logic_error);
+    EXPECT_EQ(q.size(), 6);
+}
+
+// Commit without prepare, beyond prepared, after another op --> throws
+TEST(CircArrayQueueTest, CommitRejectsSlotsNotPrepared) {
+    auto q = dsa::CircArrayQueue<char>();   // allocation deferred
+    EXPECT_THROW(q.commit(1), std::logic_error);
+    EXPECT_EQ(q.size(), 0);
+    EXPECT_THROW(q.front(), dsa::EmptyQueueError);
+
+    auto [s1, s2] = q.prepare(2);
+    s1[0] = 'a';
+    s1[1] = 'b';
+    EXPECT_THROW(q.commit(3), std::logic_error);
+    q.commit(1);
+    EXPECT_THROW(q.commit(1), std::logic_error);   // used up
+    EXPECT_EQ(q.to_string("", ""), "[a]");
+
+    q.prepare(4);
+    q.enqueue('c');
+    EXPECT_THROW(q.commit(1), std::logic_error);
+    EXPECT_EQ(q.to_string("", ""), "[ac]");
+}
+
+/* --- ALLOCATORS --- */
+
+// Queue on a memory resource --> array and elements allocated from it
+TEST(CircArrayQueueTest, AllocatesFromMemoryResource) {
+    auto buf = std::array<std::byte, 4096> {};
+    auto res = std::pmr::monotonic_buffer_resource {
+        buf.data(), buf.size(), std::pmr::null_memory_resource()
+    };
+    auto q = dsa::pmr::CircArrayQueue<std::pmr::string>(4, &res);
+
+    for (char c : { 'a', 'b', 'c', 'd', 'e' }) q.emplace(40, c);   // grows
+    auto const* elem = reinterpret_cast<std::byte const*>(&q.front());
+    EXPECT_TRUE(elem >= buf.data() && elem < buf.data() + buf.size());
+    EXPECT_EQ(q.get_allocator().resource(), &res);
+    EXPECT_EQ(q.front().get_allocator().resource(), &res);
+    EXPECT_EQ(q.front(), std::pmr::string(40, 'a'));
+
+    // Resource exhausted --> throw, queue unchanged
+    EXPECT_THROW(
+        {
+            for (;;) q.emplace(40, 'z');
+        },
+        std::bad_alloc);
+    EXPECT_EQ(q.front(), std::pmr::string(40, 'a'));
+}
+
+// Copy --> default resource; assign --> resource kept, elements copied or
+// moved one by one
+TEST(CircArrayQueueTest, PropagatesAllocatorAsDirected) {
+    using PmrQueue = dsa::pmr::CircArrayQueue<int>;
+
+    auto res1 = std::pmr::monotonic_buffer_resource {};
+    auto res2 = std::pmr::monotonic_buffer_resource {};
+    auto q1   = PmrQueue(4, &res1);
+    for (int i { 1 }; i <= 3; ++i) q1.enqueue(i);
+
+    auto copy = q1;
+    EXPECT_EQ(copy.get_allocator().resource(),
+              std::pmr::get_default_resource());
+    EXPECT_EQ(copy.to_string(), "[1 2 3]");
+
+    auto q2 = PmrQueue(&res2);
+    q2      = q1;
+    EXPECT_EQ(q2.get_allocator().resource(), &res2);
+    EXPECT_EQ(q2.to_string(), "[1 2 3]");
+
+    auto moved = std::move(q1);
+    EXPECT_EQ(moved.get_allocator().resource(), &res1);
+    q2.dequeue();
+    q2 = std::move(moved);
+    EXPECT_EQ(q2.get_allocator().resource(), &res2);
+    EXPECT_EQ(q2.to_string(), "[1 2 3]");
+    EXPECT_TRUE(moved.empty());   // NOLINT(bugprone-use-after-move)
+}
+
+// Merge queues on memory resources --> merged queue on that of the first
+TEST(CircArrayQueueTest, MergedQueueAllocatesWithAllocatorOfFirstQueue) {
+    using PmrQueue  = dsa::pmr::CircArrayQueue<int>;
+    using PmrIQueue = dsa::IQueue<int, dsa::CircArrayQueue, PmrQueue>;
+
+    auto res1 = std::pmr::monotonic_buffer_resource {};
+    auto res2 = std::pmr::monotonic_buffer_resource {};
+    auto q1   = PmrQueue(4, &res1);
+    auto q2   = PmrQueue(4, &res2);
+    for (int i : { 1, 4 }) q1.enqueue(i);
+    for (int i : { 2, 3 }) q2.enqueue(i);
+
+    auto* merged = dsa::merge<int, dsa::CircArrayQueue, std::less<int>>(
+        static_cast<PmrIQueue const*>(&q1), static_cast<PmrIQueue const*>(&q2));
+    EXPECT_EQ(static_cast<PmrQueue*>(merged)->get_allocator().resource(),
+              &res1);
+    EXPECT_EQ(merged->to_string(), "[1 2 3 4]");
+    EXPECT_EQ(q1.to_string(), "[1 4]");
+    dsa::destroy(merged);
+}
@@ -0,0 +1,128 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>   // atomic<T>
+#include <new>      // nothrow
+#include <thread>   // thread, this_thread::yield()
+
+#include "hazard_pointer.hpp"
+
+// Object that counts how many of its kind are alive
+struct Counted
+{
+    static inline int num_alive { 0 };
+
+    Counted() { ++num_alive; }
+    ~Counted() { --num_alive; }
+};
+
+/* --- REGULAR CASES --- */
+
+// Retire unprotected object --> reclaimed
+TEST(HazardPointerTest, ReclaimsUnprotectedObject) {
+    static_assert(noexcept(dsa::retire(static_cast<Counted*>(nullptr))));
+    dsa::retire(new Counted {});
+    EXPECT_EQ(Counted::num_alive, 1);   // batched
+    dsa::reclaim_retired();
+    EXPECT_EQ(Counted::num_alive, 0);
+}
+
+// Retire protected object --> reclaimed only once no longer protected
+TEST(HazardPointerTest, DefersReclaimingProtectedObject) {
+    auto src = std::atomic<Counted*> { new Counted {} };
+    {
+        dsa::HazardPointer hp;
+        auto* const        obj = hp.protect(src);
+        EXPECT_EQ(obj, src.load());
+
+        src.store(nullptr);   // unlinked
+        dsa::retire(obj);
+        dsa::reclaim_retired();
+        EXPECT_EQ(Counted::num_alive, 1);
+
+        hp.reset();
+        dsa::reclaim_retired();
+        EXPECT_EQ(Counted::num_alive, 0);
+    }
+}
+
+// Create without throwing --> protects like any other hazard pointer
+TEST(HazardPointerTest, CreatesWithoutThrowing) {
+    static_assert(noexcept(dsa::HazardPointer { std::nothrow }));
+    auto src = std::atomic<Counted*> { new Counted {} };
+    {
+        dsa::HazardPointer hp { std::nothrow };
+        ASSERT_TRUE(hp);
+        auto* const obj = hp.protect(src);
+
+        src.store(nullptr);   // unlinked
+        dsa::retire(obj);
+        dsa::reclaim_retired();
+        EXPECT_EQ(Counted::num_alive, 1);
+    }
+    dsa::reclaim_retired();
+    EXPECT_EQ(Counted::num_alive, 0);
+}
+
+// Object protected by another thread --> not reclaimed until released there
+TEST(HazardPointerTest, HonorsProtectionByOtherThreads) {
+    auto src        = std::atomic<Counted*> { new Counted {} };
+    auto protected_ = std::atomic<bool> { false };
+    auto released   = std::atomic<bool> { false };
+
+    auto reader = std::thread { [&] {
+        dsa::HazardPointer hp;
+        hp.protect(src);
+        protected_.store(true);
+        while (!released.load()) std::this_thread::yield();
+    } };
+    while (!protected_.load()) std::this_thread::yield();
+
+    dsa::retire(src.exchange(nullptr));
+    dsa::reclaim_retired();
+    EXPECT_EQ(Counted::num_alive, 1);
+
+    released.store(true);
+    reader.join();
+    dsa::reclaim_retired();
+    EXPECT_EQ(Counted::num_alive, 0);
+}
+
+// Many objects retired --> reclaimed in batches without explicit reclaiming
+TEST(HazardPointerTest, ReclaimsInBatches) {
+    for (int i { 0 }; i < 1000; ++i) dsa::retire(new Counted {});
+    EXPECT_LT(Counted::num_alive, 1000);
+    dsa::reclaim_retired();
+    EXPECT_EQ(Counted::num_alive, 0);
+}
@@ -0,0 +1,137 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <string>   // string, to_string()
+
+#include "incr_circ_array_queue.hpp"
+
+using IntIncrCircArrayQueue = dsa::IncrCircArrayQueue<int>;
+
+/* --- CORNER CASES --- */
+
+// Peek front, dequeue when empty --> throw
+TEST(IncrCircArrayQueueTest, PeekFrontOrDequeueWhenEmptyThrows) {
+    auto q = IntIncrCircArrayQueue();
+    EXPECT_THROW(q.front(), dsa::EmptyQueueError);
+    EXPECT_THROW(q.dequeue(), dsa::EmptyQueueError);
+}
+
+// Enqueue when full --> new array, old elements migrated a step at a time
+TEST(IncrCircArrayQueueTest, EnqueueWhenFullMigratesIncrementally) {
+    auto q = dsa::IncrCircArrayQueue<int, dsa::ExactCapacity,
+                                     dsa::GeometricResizing<>, 2>(8);
+    for (int i { 0 }; i < 8; ++i) q.enqueue(i);
+    EXPECT_FALSE(q.resizing());
+
+    q.enqueue(8);
+    EXPECT_EQ(q.capacity(), 16);
+    EXPECT_TRUE(q.resizing());
+    EXPECT_EQ(q.to_string(), "[0 1 2 3 4 5 6 7 8]");
+
+    // 2 elements migrated per operation, 6 left in the old array
+    q.enqueue(9);
+    q.enqueue(10);
+    EXPECT_TRUE(q.resizing());
+    q.enqueue(11);
+    EXPECT_FALSE(q.resizing());
+    EXPECT_EQ(q.to_string(), "[0 1 2 3 4 5 6 7 8 9 10 11]");
+}
+
+// Dequeue from the old array while resizing --> elements in order
+TEST(IncrCircArrayQueueTest, DequeueWhileResizingKeepsOrder) {
+    auto q = dsa::IncrCircArrayQueue<int, dsa::ExactCapacity,
+                                     dsa::GeometricResizing<>, 1>(4);
+    q.enqueue(-1);
+    q.dequeue();   // old elements will wrap around
+    for (int i { 0 }; i < 5; ++i) q.enqueue(i);
+    EXPECT_TRUE(q.resizing());
+
+    for (int i { 0 }; i < 3; ++i) {
+        EXPECT_EQ(q.front(), i);
+        q.dequeue();
+    }
+    q.enqueue(5);
+    EXPECT_FALSE(q.resizing());
+    EXPECT_EQ(q.to_string(), "[3 4 5]");
+}
+
+// Dequeue when just a quarter full --> shrink incrementally
+TEST(IncrCircArrayQueueTest, DequeueWhenQuarterFullShrinks) {
+    auto q = dsa::IncrCircArrayQueue<std::string, dsa::PowerOfTwoCapacity,
+                                     dsa::GeometricResizing<>, 1>(16);
+    for (int i { 0 }; i < 5; ++i) q.enqueue(std::to_string(i));
+    q.dequeue();
+    q.dequeue();   // 3 * 4 < 16
+    EXPECT_EQ(q.capacity(), 8);
+    EXPECT_TRUE(q.resizing());
+
+    auto copy = q;
+    EXPECT_FALSE(copy.resizing());
+    EXPECT_EQ(copy.to_string(), "[2 3 4]");
+
+    q.dequeue();
+    EXPECT_FALSE(q.resizing());
+    EXPECT_EQ(q.to_string(), "[3 4]");
+}
+
+/* --- REGULAR CASES --- */
+
+// Enqueue, dequeue many, across resizes --> FIFO order
+TEST(IncrCircArrayQueueTest, EnqueueDequeueManyKeepsOrder) {
+    auto q = IntIncrCircArrayQueue(1);
+    int  next_in { 0 }, next_out { 0 };
+    for (int round { 0 }; round < 200; ++round) {
+        for (int i { 0 }; i < 3; ++i) q.enqueue(next_in++);
+        EXPECT_EQ(q.front(), next_out++);
+        q.dequeue();
+    }
+    while (!q.empty()) {
+        EXPECT_EQ(q.front(), next_out++);
+        q.dequeue();
+    }
+    EXPECT_EQ(next_out, next_in);
+    EXPECT_FALSE(q.resizing());
+}
+
+// Splice --> elements moved one by one in order, other queue empty
+TEST(IncrCircArrayQueueTest, SpliceMovesElementsInOrder) {
+    auto q     = IntIncrCircArrayQueue(2);
+    auto other = IntIncrCircArrayQueue(2);
+    for (int i { 0 }; i < 3; ++i) q.enqueue(i);
+    for (int i { 3 }; i < 8; ++i) other.enqueue(i);
+
+    q.splice(other);
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(q.to_string(), "[0 1 2 3 4 5 6 7]");
+}
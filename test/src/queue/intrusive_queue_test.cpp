@@ -0,0 +1,200 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <memory>   // make_unique()
+#include <string>   // string
+#include <vector>   // vector<T>
+
+#include "intrusive_queue.hpp"
+
+struct Request
+{
+    int                              id;
+    dsa::IntrusiveQueueHook<Request> pending;
+    dsa::IntrusiveQueueHook<Request> audit;
+
+    explicit Request(int n = 0) : id { n } {}
+};
+
+using RequestQueue      = dsa::IntrusiveQueue<Request, &Request::pending>;
+using AuditRequestQueue = dsa::IntrusiveQueue<Request, &Request::audit>;
+
+/* --- CORNER CASES --- */
+
+// Dequeue or access front of empty queue --> EmptyQueueError, try_dequeue()
+// returns nullptr
+TEST(IntrusiveQueueTest, DequeueOrFrontWhenEmptyThrows) {
+    auto queue = RequestQueue();
+    EXPECT_TRUE(queue.empty());
+    EXPECT_THROW(queue.dequeue(), dsa::EmptyQueueError);
+    EXPECT_THROW(queue.front(), dsa::EmptyQueueError);
+    EXPECT_EQ(queue.try_dequeue(), nullptr);
+}
+
+// Enqueue and dequeue a single element repeatedly --> element unlinked after
+// each dequeue
+TEST(IntrusiveQueueTest, SingleElementIsUnlinkedOnDequeue) {
+    auto queue   = RequestQueue();
+    auto request = Request { 1 };
+    for (int i { 0 }; i < 3; ++i) {
+        queue.enqueue(request);
+        EXPECT_TRUE(request.pending.linked());
+        EXPECT_EQ(&queue.front(), &request);
+        EXPECT_EQ(&queue.dequeue(), &request);
+        EXPECT_FALSE(request.pending.linked());
+        EXPECT_TRUE(queue.empty());
+    }
+}
+
+// Copy an element in a queue --> the copy is not in the queue
+TEST(IntrusiveQueueTest, CopyOfLinkedElementIsNotLinked) {
+    auto queue   = RequestQueue();
+    auto request = Request { 1 };
+    queue.enqueue(request);
+
+    auto copy = request;
+    EXPECT_FALSE(copy.pending.linked());
+    copy = request;
+    EXPECT_FALSE(copy.pending.linked());
+    request = Request { 2 };
+    EXPECT_TRUE(request.pending.linked());
+    EXPECT_EQ(queue.size(), 1);
+}
+
+/* --- REGULAR CASES --- */
+
+// Enqueue caller-owned elements --> dequeued by reference in FIFO order
+TEST(IntrusiveQueueTest, DequeuesElementsInFifoOrder) {
+    auto requests = std::vector<std::unique_ptr<Request>> {};
+    auto queue    = RequestQueue();
+    for (int i { 0 }; i < 5; ++i) {
+        requests.push_back(std::make_unique<Request>(i));
+        queue.enqueue(*requests.back());
+    }
+    EXPECT_EQ(queue.size(), 5);
+
+    auto ids = std::string {};
+    queue.iter([&ids](Request const& request) {
+        ids += std::to_string(request.id);
+    });
+    EXPECT_EQ(ids, "01234");
+
+    for (int i { 0 }; i < 5; ++i) {
+        EXPECT_EQ(&queue.front(), requests[i].get());
+        EXPECT_EQ(&queue.dequeue(), requests[i].get());
+        if (i == 1) queue.enqueue(*requests[0]);
+    }
+    EXPECT_EQ(queue.try_dequeue(), requests[0].get());
+    EXPECT_TRUE(queue.empty());
+}
+
+// Element with two hooks --> in two queues at once, in different orders
+TEST(IntrusiveQueueTest, ElementIsInOneQueuePerHook) {
+    auto requests = std::vector<Request>(3);
+    auto pending  = RequestQueue();
+    auto audit    = AuditRequestQueue();
+    for (int i { 0 }; i < 3; ++i) {
+        requests[i].id = i;
+        pending.enqueue(requests[i]);
+        audit.enqueue(requests[2 - i]);
+    }
+
+    EXPECT_EQ(pending.dequeue().id, 0);
+    EXPECT_EQ(audit.dequeue().id, 2);
+    EXPECT_TRUE(requests[0].audit.linked());
+    EXPECT_FALSE(requests[2].audit.linked());
+    EXPECT_TRUE(requests[2].pending.linked());
+}
+
+// Destroy a queue with elements in it --> elements unlinked, and can be
+// enqueued again
+TEST(IntrusiveQueueTest, DestroyUnlinksElements) {
+    auto requests = std::vector<Request>(3);
+    {
+        auto queue = RequestQueue();
+        for (auto& request : requests) queue.enqueue(request);
+    }
+    for (auto const& request : requests) EXPECT_FALSE(request.pending.linked());
+
+    auto queue = RequestQueue();
+    queue.enqueue(requests[1]);
+    EXPECT_EQ(&queue.front(), &requests[1]);
+}
+
+// Move-construct and move-assign --> elements taken over, source empty;
+// elements of the assigned-to queue unlinked
+TEST(IntrusiveQueueTest, MoveTakesOverElements) {
+    auto requests = std::vector<Request>(4);
+    auto queue    = RequestQueue();
+    for (int i { 0 }; i < 3; ++i) {
+        requests[i].id = i;
+        queue.enqueue(requests[i]);
+    }
+
+    auto moved = std::move(queue);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(moved.size(), 3);
+    EXPECT_EQ(moved.front().id, 0);
+
+    auto other = RequestQueue();
+    other.enqueue(requests[3]);
+    other = std::move(moved);
+    EXPECT_TRUE(moved.empty());
+    EXPECT_FALSE(requests[3].pending.linked());
+    EXPECT_EQ(other.size(), 3);
+
+    other.clear();
+    EXPECT_TRUE(other.empty());
+    for (auto const& request : requests) EXPECT_FALSE(request.pending.linked());
+}
+
+// Splice --> elements of the other queue linked after those of this one,
+// other queue empty
+TEST(IntrusiveQueueTest, SpliceLinksElementsInOrder) {
+    auto requests = std::vector<Request>(5);
+    auto queue    = RequestQueue();
+    auto other    = RequestQueue();
+    for (int i { 0 }; i < 5; ++i) {
+        requests[i].id = i;
+        (i < 2 ? queue : other).enqueue(requests[i]);
+    }
+
+    queue.splice(queue);
+    queue.splice(other);
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(queue.size(), 5);
+    other.splice(queue);
+    EXPECT_TRUE(queue.empty());
+    for (int i { 0 }; i < 5; ++i) EXPECT_EQ(other.dequeue().id, i);
+}
@@ -0,0 +1,162 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>      // atomic<T>
+#include <cstddef>     // size_t
+#include <memory>      // unique_ptr<T>, make_unique()
+#include <stdexcept>   // runtime_error
+#include <string>      // string
+#include <thread>      // thread, this_thread::yield()
+#include <vector>      // vector<T>
+
+#include "mpmc_ring_queue.hpp"
+
+using IntMPMCRingQueue = dsa::MPMCRingQueue<int>;
+
+// Element type whose constructor throws on demand
+struct Fragile
+{
+    int value;
+
+    Fragile(int value_, bool fail = false) : value { value_ } {
+        if (fail) throw std::runtime_error { "construction failed" };
+    }
+};
+
+/* --- CORNER CASES --- */
+
+// Peek front, dequeue when empty --> throw; try dequeue --> false
+TEST(MPMCRingQueueTest, PeekFrontOrDequeueWhenEmptyFails) {
+    auto q = IntMPMCRingQueue(4);
+    EXPECT_TRUE(q.empty());
+    EXPECT_THROW(q.front(), dsa::EmptyQueueError);
+    EXPECT_THROW(q.dequeue(), dsa::EmptyQueueError);
+    int out { -1 };
+    EXPECT_FALSE(q.try_dequeue(out));
+    EXPECT_FALSE(q.try_dequeue_spin(out, 8));
+    EXPECT_EQ(out, -1);
+}
+
+// Enqueue when full --> throw; try enqueue --> false; capacity unchanged
+TEST(MPMCRingQueueTest, EnqueueWhenFullFails) {
+    auto q = IntMPMCRingQueue(1);   // raised to 2
+    EXPECT_EQ(q.capacity(), 2);
+    EXPECT_TRUE(q.try_enqueue(0));
+    EXPECT_TRUE(q.try_enqueue_spin(1, 0));
+    EXPECT_FALSE(q.try_enqueue(2));
+    EXPECT_FALSE(q.try_emplace_spin(8, 2));
+    EXPECT_THROW(q.enqueue(2), dsa::FullQueueError);
+    EXPECT_THROW(q.emplace(2), dsa::FullQueueError);
+    EXPECT_EQ(q.capacity(), 2);
+    EXPECT_EQ(q.to_string(), "[0 1]");
+}
+
+// Element constructor throws --> queue unchanged and still usable
+TEST(MPMCRingQueueTest, ThrowingConstructorLeavesQueueUnchanged) {
+    auto q = dsa::MPMCRingQueue<Fragile>(2);
+    q.emplace(1);
+    EXPECT_THROW(q.emplace(2, true), std::runtime_error);
+    EXPECT_EQ(q.size(), 1);
+    EXPECT_TRUE(q.try_emplace(3));
+
+    auto out = Fragile { 0 };
+    EXPECT_TRUE(q.try_dequeue(out));
+    EXPECT_EQ(out.value, 1);
+    EXPECT_TRUE(q.try_dequeue(out));
+    EXPECT_EQ(out.value, 3);
+    EXPECT_TRUE(q.empty());
+}
+
+/* --- REGULAR CASES --- */
+
+// Drain and refill across the end of the array --> elements in FIFO order
+TEST(MPMCRingQueueTest, WrapAroundPreservesOrder) {
+    auto q = dsa::MPMCRingQueue<std::string>(4);
+    for (auto const* word : { "a", "b", "c", "d" }) q.enqueue(word);
+    q.dequeue();
+    q.dequeue();
+    EXPECT_TRUE(q.try_enqueue("e"));
+    q.emplace(1, 'f');
+    EXPECT_EQ(q.size(), 4);
+    EXPECT_EQ(q.front(), "c");
+    EXPECT_EQ(q.to_string(), "[c d e f]");
+
+    std::string out;
+    EXPECT_TRUE(q.try_dequeue_spin(out, 0));
+    EXPECT_EQ(out, "c");
+    EXPECT_EQ(q.size(), 3);
+}
+
+// Several producers and consumers --> every element received exactly once,
+// and the elements of each producer in the order it added them
+TEST(MPMCRingQueueTest, TransfersBetweenThreadsExactlyOnce) {
+    constexpr std::size_t num_threads { 4 };
+    constexpr std::size_t num_elems_per_producer { 1 << 14 };
+    constexpr std::size_t num_elems { num_threads * num_elems_per_producer };
+    auto q = std::make_unique<dsa::MPMCRingQueue<std::size_t>>(64);
+
+    auto seen             = std::vector<std::atomic<int>>(num_elems);
+    auto num_out_of_order = std::atomic<std::size_t> { 0 };
+    auto threads          = std::vector<std::thread> {};
+    for (std::size_t t { 0 }; t < num_threads; ++t) {
+        threads.emplace_back([&q, t] {
+            for (std::size_t i { 0 }; i < num_elems_per_producer; ++i) {
+                auto const elem = t * num_elems_per_producer + i;
+                while (!q->try_enqueue_spin(elem, 64)) {}
+            }
+        });
+        threads.emplace_back([&q, &seen, &num_out_of_order] {
+            // Last element received from each producer
+            auto last = std::vector<std::size_t>(num_threads, 0);
+            for (std::size_t i { 0 }, out { 0 }; i < num_elems_per_producer;) {
+                if (!q->try_dequeue(out)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                seen[out].fetch_add(1);
+                auto const producer = out / num_elems_per_producer;
+                if (last[producer] > out) num_out_of_order.fetch_add(1);
+                last[producer] = out;
+                ++i;
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    std::size_t num_not_seen_once { 0 };
+    for (auto const& count : seen) num_not_seen_once += count.load() != 1;
+    EXPECT_EQ(num_not_seen_once, 0);
+    EXPECT_EQ(num_out_of_order.load(), 0);
+    EXPECT_TRUE(q->empty());
+}
@@ -0,0 +1,174 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>      // atomic<T>
+#include <cstddef>     // size_t
+#include <memory>      // shared_ptr<T>, make_shared(), make_unique()
+#include <stdexcept>   // runtime_error
+#include <string>      // string
+#include <thread>      // thread, this_thread::yield()
+#include <vector>      // vector<T>
+
+#include "segmented_array_queue.hpp"
+
+// Small segments, so that tests cross segment boundaries
+using IntSegmentedArrayQueue = dsa::SegmentedArrayQueue<int, 4>;
+
+/* --- CORNER CASES --- */
+
+// Peek front, dequeue when empty --> throw; try dequeue --> false
+TEST(SegmentedArrayQueueTest, PeekFrontOrDequeueWhenEmptyFails) {
+    auto q = IntSegmentedArrayQueue();
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(q.size(), 0);
+    EXPECT_THROW(q.front(), dsa::EmptyQueueError);
+    EXPECT_THROW(q.dequeue(), dsa::EmptyQueueError);
+    int out { -1 };
+    static_assert(noexcept(q.try_dequeue(out)));
+    EXPECT_FALSE(q.try_dequeue(out));
+    EXPECT_EQ(out, -1);
+}
+
+// Element constructor throws --> queue unchanged and still usable
+TEST(SegmentedArrayQueueTest, ThrowingConstructorLeavesQueueUnchanged) {
+    struct Fragile
+    {
+        int value;
+
+        Fragile(int value_, bool fail = false) : value { value_ } {
+            if (fail) throw std::runtime_error { "construction failed" };
+        }
+    };
+
+    auto q = dsa::SegmentedArrayQueue<Fragile, 2>();
+    q.emplace(1);
+    EXPECT_THROW(q.emplace(2, true), std::runtime_error);
+    q.emplace(3);
+    q.emplace(4);
+
+    auto out = Fragile { 0 };
+    for (int expected : { 1, 3, 4 }) {
+        EXPECT_TRUE(q.try_dequeue(out));
+        EXPECT_EQ(out.value, expected);
+    }
+    EXPECT_FALSE(q.try_dequeue(out));
+}
+
+/* --- REGULAR CASES --- */
+
+// Enqueue across several segments, dequeue --> elements in FIFO order
+TEST(SegmentedArrayQueueTest, PreservesOrderAcrossSegments) {
+    auto q = dsa::SegmentedArrayQueue<std::string, 4>();
+    for (auto const* word : { "a", "b", "c", "d", "e", "f" }) q.enqueue(word);
+    q.emplace(1, 'g');
+    EXPECT_EQ(q.size(), 7);
+    EXPECT_FALSE(q.empty());
+    EXPECT_EQ(q.front(), "a");
+    EXPECT_EQ(q.to_string(), "[a b c d e f g]");
+
+    for (int i { 0 }; i < 4; ++i) q.dequeue();
+    std::string out;
+    EXPECT_TRUE(q.try_dequeue(out));
+    EXPECT_EQ(out, "e");
+    EXPECT_EQ(q.size(), 2);
+    EXPECT_EQ(q.to_string(), "[f g]");
+}
+
+// Fill and drain repeatedly --> elements in FIFO order as segments recycle
+TEST(SegmentedArrayQueueTest, FillAndDrainRepeatedly) {
+    auto q = IntSegmentedArrayQueue();
+    for (int round { 0 }; round < 100; ++round) {
+        for (int i { 0 }; i < 10; ++i) q.enqueue(round * 10 + i);
+        for (int i { 0 }; i < 10; ++i) {
+            EXPECT_EQ(q.front(), round * 10 + i);
+            q.dequeue();
+        }
+        dsa::reclaim_retired();
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+// Elements left in queue --> destroyed with the queue
+TEST(SegmentedArrayQueueTest, DestroysRemainingElements) {
+    auto elem = std::make_shared<int>(42);
+    {
+        auto q = dsa::SegmentedArrayQueue<std::shared_ptr<int>, 4>();
+        for (int i { 0 }; i < 9; ++i) q.enqueue(elem);
+        for (int i { 0 }; i < 5; ++i) q.dequeue();
+        EXPECT_EQ(elem.use_count(), 5);
+    }
+    EXPECT_EQ(elem.use_count(), 1);
+}
+
+// Several producers and consumers --> every element received exactly once,
+// and the elements of each producer in the order it added them
+TEST(SegmentedArrayQueueTest, TransfersBetweenThreadsExactlyOnce) {
+    constexpr std::size_t num_threads { 4 };
+    constexpr std::size_t num_elems_per_producer { 1 << 14 };
+    constexpr std::size_t num_elems { num_threads * num_elems_per_producer };
+    auto q = std::make_unique<dsa::SegmentedArrayQueue<std::size_t, 64>>();
+
+    auto seen             = std::vector<std::atomic<int>>(num_elems);
+    auto num_out_of_order = std::atomic<std::size_t> { 0 };
+    auto threads          = std::vector<std::thread> {};
+    for (std::size_t t { 0 }; t < num_threads; ++t) {
+        threads.emplace_back([&q, t] {
+            for (std::size_t i { 0 }; i < num_elems_per_producer; ++i) {
+                q->enqueue(t * num_elems_per_producer + i);
+            }
+        });
+        threads.emplace_back([&q, &seen, &num_out_of_order] {
+            // Last element received from each producer
+            auto last = std::vector<std::size_t>(num_threads, 0);
+            for (std::size_t i { 0 }, out { 0 }; i < num_elems_per_producer;) {
+                if (!q->try_dequeue(out)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                seen[out].fetch_add(1);
+                auto const producer = out / num_elems_per_producer;
+                if (last[producer] > out) num_out_of_order.fetch_add(1);
+                last[producer] = out;
+                ++i;
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    std::size_t num_not_seen_once { 0 };
+    for (auto const& count : seen) num_not_seen_once += count.load() != 1;
+    EXPECT_EQ(num_not_seen_once, 0);
+    EXPECT_EQ(num_out_of_order.load(), 0);
+    EXPECT_TRUE(q->empty());
+}
@@ -0,0 +1,157 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>    // atomic<T>
+#include <cstddef>   // size_t
+#include <memory>    // unique_ptr<T>, make_unique()
+#include <string>    // string
+#include <thread>    // thread, this_thread::yield()
+#include <vector>    // vector<T>
+
+#include "sharded_queue.hpp"
+
+using IntShardedQueue = dsa::ShardedQueue<int>;
+
+/* --- CORNER CASES --- */
+
+// Peek front, dequeue when empty --> throw; try dequeue --> false
+TEST(ShardedQueueTest, PeekFrontOrDequeueWhenEmptyFails) {
+    auto q = IntShardedQueue(4);
+    EXPECT_TRUE(q.empty());
+    EXPECT_THROW(q.front(), dsa::EmptyQueueError);
+    EXPECT_THROW(q.dequeue(), dsa::EmptyQueueError);
+    int out { -1 };
+    EXPECT_FALSE(q.try_dequeue(out));
+    EXPECT_EQ(out, -1);
+}
+
+// Create with no shards --> one shard, in FIFO order
+TEST(ShardedQueueTest, CreateWithNoShardsKeepsOne) {
+    auto q = IntShardedQueue(0);
+    EXPECT_EQ(q.num_shards(), 1);
+    for (int i { 0 }; i < 4; ++i) q.enqueue(i);
+    EXPECT_EQ(q.to_string(), "[0 1 2 3]");
+    q.dequeue();
+    EXPECT_EQ(q.front(), 1);
+}
+
+/* --- REGULAR CASES --- */
+
+// Add and remove from a single thread --> elements in FIFO order
+TEST(ShardedQueueTest, SingleThreadPreservesOrder) {
+    auto q = dsa::ShardedQueue<std::string>(4);
+    for (auto const* word : { "a", "b", "c" }) q.enqueue(word);
+    q.emplace(2, 'd');
+    EXPECT_EQ(q.size(), 4);
+    EXPECT_EQ(q.front(), "a");
+    EXPECT_EQ(q.to_string(), "[a b c dd]");
+
+    std::string out;
+    for (auto const* word : { "a", "b", "c", "dd" }) {
+        EXPECT_TRUE(q.try_dequeue(out));
+        EXPECT_EQ(out, word);
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+// Remove elements added by other threads --> taken from their shards, in
+// the order each thread added them
+TEST(ShardedQueueTest, RemovesFromOtherShards) {
+    constexpr int num_threads { 3 };
+    constexpr int num_elems_per_producer { 100 };
+    auto q         = IntShardedQueue(num_threads);
+    auto producers = std::vector<std::thread> {};
+    for (int t { 0 }; t < num_threads; ++t) {
+        producers.emplace_back([&q, t] {
+            for (int i { 0 }; i < num_elems_per_producer; ++i) {
+                q.enqueue(t * num_elems_per_producer + i);
+            }
+        });
+    }
+    for (auto& thread : producers) thread.join();
+    EXPECT_EQ(q.size(), num_threads * num_elems_per_producer);
+
+    auto last = std::vector<int>(num_threads, -1);
+    for (int out; q.try_dequeue(out);) {
+        auto const producer = out / num_elems_per_producer;
+        EXPECT_LT(last[producer], out);
+        last[producer] = out;
+    }
+    for (int t { 0 }; t < num_threads; ++t) {
+        EXPECT_EQ(last[t], (t + 1) * num_elems_per_producer - 1);
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+// Several producers and consumers --> every element received exactly once,
+// and the elements of each producer in the order it added them
+TEST(ShardedQueueTest, TransfersBetweenThreadsExactlyOnce) {
+    constexpr std::size_t num_threads { 4 };
+    constexpr std::size_t num_elems_per_producer { 1 << 14 };
+    constexpr std::size_t num_elems { num_threads * num_elems_per_producer };
+    auto q = std::make_unique<dsa::ShardedQueue<std::size_t>>(num_threads);
+
+    auto seen             = std::vector<std::atomic<int>>(num_elems);
+    auto num_out_of_order = std::atomic<std::size_t> { 0 };
+    auto threads          = std::vector<std::thread> {};
+    for (std::size_t t { 0 }; t < num_threads; ++t) {
+        threads.emplace_back([&q, t] {
+            for (std::size_t i { 0 }; i < num_elems_per_producer; ++i) {
+                q->enqueue(t * num_elems_per_producer + i);
+            }
+        });
+        threads.emplace_back([&q, &seen, &num_out_of_order] {
+            // Last element received from each producer
+            auto last = std::vector<std::size_t>(num_threads, 0);
+            for (std::size_t i { 0 }, out { 0 }; i < num_elems_per_producer;) {
+                if (!q->try_dequeue(out)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                seen[out].fetch_add(1);
+                auto const producer = out / num_elems_per_producer;
+                if (last[producer] > out) num_out_of_order.fetch_add(1);
+                last[producer] = out;
+                ++i;
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    std::size_t num_not_seen_once { 0 };
+    for (auto const& count : seen) num_not_seen_once += count.load() != 1;
+    EXPECT_EQ(num_not_seen_once, 0);
+    EXPECT_EQ(num_out_of_order.load(), 0);
+    EXPECT_TRUE(q->empty());
+}
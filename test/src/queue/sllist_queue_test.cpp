@@ -0,0 +1,299 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <array>             // array<T, N>
+#include <cstddef>           // size_t, byte
+#include <memory>            // shared_ptr<T>, make_shared()
+#include <memory_resource>   // pmr::monotonic_buffer_resource, ...
+#include <new>               // bad_alloc
+#include <set>               // set<T>
+#include <stdexcept>         // runtime_error
+#include <string>            // string, pmr::string
+#include <utility>           // move()
+
+#include "sllist_queue.hpp"
+
+using IntSLListQueue = dsa::SLListQueue<int>;
+
+/* --- CORNER CASES --- */
+
+// Peek front, dequeue when empty --> throw
+TEST(SLListQueueTest, PeekFrontOrDequeueWhenEmptyFails) {
+    auto q = IntSLListQueue();
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(q.size(), 0);
+    EXPECT_THROW(q.front(), dsa::EmptyQueueError);
+    EXPECT_THROW(q.dequeue(), dsa::EmptyQueueError);
+    EXPECT_EQ(q.to_string(), "[]");
+}
+
+// Element constructor throws --> queue unchanged and still usable
+TEST(SLListQueueTest, ThrowingConstructorLeavesQueueUnchanged) {
+    struct Fragile
+    {
+        int value;
+
+        Fragile(int value_, bool fail = false) : value { value_ } {
+            if (fail) throw std::runtime_error { "construction failed" };
+        }
+    };
+
+    auto q = dsa::SLListQueue<Fragile>();
+    EXPECT_THROW(q.emplace(0, true), std::runtime_error);
+    EXPECT_TRUE(q.empty());
+    q.emplace(1);
+    EXPECT_THROW(q.emplace(2, true), std::runtime_error);
+    q.emplace(3);
+
+    EXPECT_EQ(q.size(), 2);
+    for (int expected : { 1, 3 }) {
+        EXPECT_EQ(q.front().value, expected);
+        q.dequeue();
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+/* --- REGULAR CASES --- */
+
+// Enqueue, emplace, dequeue --> elements in FIFO order
+TEST(SLListQueueTest, PreservesOrder) {
+    auto q = dsa::SLListQueue<std::string>();
+    for (auto const* word : { "a", "b", "c" }) q.enqueue(word);
+    auto word = std::string { "d" };
+    q.enqueue(std::move(word));
+    q.emplace(1, 'e');
+    EXPECT_EQ(q.size(), 5);
+    EXPECT_FALSE(q.empty());
+    EXPECT_EQ(q.front(), "a");
+    EXPECT_EQ(q.to_string(), "[a b c d e]");
+
+    q.front() = "z";
+    EXPECT_EQ(q.to_string(), "[z b c d e]");
+    for (int i { 0 }; i < 3; ++i) q.dequeue();
+    EXPECT_EQ(q.to_string(), "[d e]");
+}
+
+// Enqueue past several blocks of nodes --> elements in FIFO order
+TEST(SLListQueueTest, PreservesOrderAcrossBlocks) {
+    auto q = IntSLListQueue();
+    for (int i { 0 }; i < 5000; ++i) q.enqueue(i);
+    EXPECT_EQ(q.size(), 5000);
+    for (int i { 0 }; i < 5000; ++i) {
+        EXPECT_EQ(q.front(), i);
+        q.dequeue();
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+// Dequeue then enqueue --> the node of the removed element reused
+TEST(SLListQueueTest, ReusesNodesOfRemovedElements) {
+    auto q = IntSLListQueue();
+    for (int i { 0 }; i < 3; ++i) q.enqueue(i);
+    auto const* front = &q.front();
+    q.dequeue();
+    q.enqueue(3);
+    q.dequeue();
+    q.dequeue();
+    EXPECT_EQ(&q.front(), front);
+    EXPECT_EQ(q.front(), 3);
+
+    // Fill and drain repeatedly --> no nodes but those of the first round
+    auto addrs = std::set<int const*> {};
+    for (int round { 0 }; round < 100; ++round) {
+        for (int i { 0 }; i < 64; ++i) q.enqueue(round * 64 + i);
+        q.iter([&](int const& elem) {
+            if (round == 0) addrs.insert(&elem);
+            else EXPECT_TRUE(addrs.contains(&elem));
+        });
+        for (int i { 0 }; i < 64; ++i) q.dequeue();
+    }
+    EXPECT_EQ(addrs.size(), 65);
+}
+
+// Copy, then modify either queue --> the other unchanged
+TEST(SLListQueueTest, CopiesAreIndependent) {
+    auto q = IntSLListQueue();
+    for (int i { 0 }; i < 5; ++i) q.enqueue(i);
+    q.dequeue();
+
+    auto copy = q;
+    EXPECT_EQ(copy.to_string(), "[1 2 3 4]");
+    copy.enqueue(5);
+    q.dequeue();
+    EXPECT_EQ(copy.to_string(), "[1 2 3 4 5]");
+    EXPECT_EQ(q.to_string(), "[2 3 4]");
+
+    copy = q;
+    EXPECT_EQ(copy.to_string(), "[2 3 4]");
+    copy = copy;
+    EXPECT_EQ(copy.to_string(), "[2 3 4]");
+}
+
+// Move construct, move assign --> elements moved, source left empty
+TEST(SLListQueueTest, MovesElementsAndLeavesSourceEmpty) {
+    auto q = IntSLListQueue();
+    for (int i { 0 }; i < 3; ++i) q.enqueue(i);
+
+    auto moved = std::move(q);
+    EXPECT_EQ(moved.to_string(), "[0 1 2]");
+    EXPECT_TRUE(q.empty());   // NOLINT(bugprone-use-after-move)
+
+    q.enqueue(9);
+    EXPECT_EQ(q.to_string(), "[9]");
+    q = std::move(moved);
+    EXPECT_EQ(q.to_string(), "[0 1 2]");
+    EXPECT_TRUE(moved.empty());   // NOLINT(bugprone-use-after-move)
+}
+
+// Elements left in queue --> destroyed with the queue
+TEST(SLListQueueTest, DestroysRemainingElements) {
+    auto elem = std::make_shared<int>(42);
+    {
+        auto q = dsa::SLListQueue<std::shared_ptr<int>>();
+        for (int i { 0 }; i < 20; ++i) q.enqueue(elem);
+        for (int i { 0 }; i < 5; ++i) q.dequeue();
+        EXPECT_EQ(elem.use_count(), 16);
+
+        auto copy = q;
+        EXPECT_EQ(elem.use_count(), 31);
+        copy = dsa::SLListQueue<std::shared_ptr<int>>();
+        EXPECT_EQ(elem.use_count(), 16);
+    }
+    EXPECT_EQ(elem.use_count(), 1);
+}
+
+// Queue on a memory resource --> memory and elements allocated from it
+TEST(SLListQueueTest, AllocatesFromMemoryResource) {
+    auto buf = std::array<std::byte, 8192> {};
+    auto res = std::pmr::monotonic_buffer_resource {
+        buf.data(), buf.size(), std::pmr::null_memory_resource()
+    };
+    auto q = dsa::pmr::SLListQueue<std::pmr::string>(&res);
+    for (char c : { 'a', 'b', 'c' }) q.emplace(40, c);
+    EXPECT_EQ(q.get_allocator().resource(), &res);
+    EXPECT_EQ(q.front().get_allocator().resource(), &res);
+    EXPECT_EQ(q.front(), std::pmr::string(40, 'a'));
+
+    // Resource exhausted --> throw, queue unchanged
+    std::size_t n { 0 };
+    EXPECT_THROW(
+        {
+            for (;; ++n) q.emplace(40, 'z');
+        },
+        std::bad_alloc);
+    EXPECT_EQ(q.size(), 3 + n);
+    q.dequeue();
+    EXPECT_EQ(q.front(), std::pmr::string(40, 'b'));
+}
+
+// Copy --> default resource; assign --> resource kept, elements copied or
+// moved one by one
+TEST(SLListQueueTest, PropagatesAllocatorAsDirected) {
+    using PmrQueue = dsa::pmr::SLListQueue<int>;
+
+    auto res1 = std::pmr::monotonic_buffer_resource {};
+    auto res2 = std::pmr::monotonic_buffer_resource {};
+    auto q1   = PmrQueue(&res1);
+    for (int i { 1 }; i <= 3; ++i) q1.enqueue(i);
+
+    auto copy = q1;
+    EXPECT_EQ(copy.get_allocator().resource(),
+              std::pmr::get_default_resource());
+    EXPECT_EQ(copy.to_string(), "[1 2 3]");
+
+    auto q2 = PmrQueue(&res2);
+    q2      = q1;
+    EXPECT_EQ(q2.get_allocator().resource(), &res2);
+    EXPECT_EQ(q2.to_string(), "[1 2 3]");
+
+    auto moved = std::move(q1);
+    EXPECT_EQ(moved.get_allocator().resource(), &res1);
+    q2.dequeue();
+    q2 = std::move(moved);
+    EXPECT_EQ(q2.get_allocator().resource(), &res2);
+    EXPECT_EQ(q2.to_string(), "[1 2 3]");
+    EXPECT_TRUE(moved.empty());   // NOLINT(bugprone-use-after-move)
+}
+
+// Splice --> nodes relinked in place, free nodes of both queues reused;
+// splice into empty queue --> nodes swapped
+TEST(SLListQueueTest, SpliceRelinksNodes) {
+    auto q     = IntSLListQueue();
+    auto other = IntSLListQueue();
+    for (int i { 1 }; i <= 3; ++i) q.enqueue(i);
+    for (int i { 4 }; i <= 40; ++i) other.enqueue(i);
+    auto other_addrs = std::set<int const*> {};
+    other.iter([&other_addrs](int const& num) { other_addrs.insert(&num); });
+    for (int i { 0 }; i < 30; ++i) other.dequeue();
+    auto const* elem = &other.front();
+
+    q.splice(other);
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(q.to_string(), "[1 2 3 34 35 36 37 38 39 40]");
+    auto addrs = std::set<int const*> {};
+    q.iter([&addrs](int const& num) { addrs.insert(&num); });
+    EXPECT_TRUE(addrs.contains(elem));
+
+    // 16 nodes of this queue and 64 of the other, with 10 in use
+    for (int i { 0 }; i < 70; ++i) q.enqueue(i);
+    addrs.clear();
+    q.iter([&addrs](int const& num) { addrs.insert(&num); });
+    EXPECT_EQ(addrs.size(), 80);
+    for (auto const* addr : other_addrs) EXPECT_TRUE(addrs.contains(addr));
+
+    other.splice(q);
+    EXPECT_TRUE(q.empty());
+    auto swapped = std::set<int const*> {};
+    other.iter([&swapped](int const& num) { swapped.insert(&num); });
+    EXPECT_EQ(swapped, addrs);
+    q.enqueue(7);
+    EXPECT_EQ(q.to_string(), "[7]");
+}
+
+// Splice across memory resources --> elements moved one by one
+TEST(SLListQueueTest, SpliceAcrossResourcesMovesElements) {
+    using PmrQueue = dsa::pmr::SLListQueue<int>;
+
+    auto res1  = std::pmr::monotonic_buffer_resource {};
+    auto res2  = std::pmr::monotonic_buffer_resource {};
+    auto q     = PmrQueue(&res1);
+    auto other = PmrQueue(&res2);
+    q.enqueue(1);
+    for (int i { 2 }; i <= 4; ++i) other.enqueue(i);
+
+    q.splice(other);
+    EXPECT_EQ(q.to_string(), "[1 2 3 4]");
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(q.get_allocator().resource(), &res1);
+}
@@ -0,0 +1,134 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <memory>    // make_unique()
+#include <string>    // string, to_string()
+#include <utility>   // move()
+
+#include "small_circ_array_queue.hpp"
+
+using IntSmallCircArrayQueue = dsa::SmallCircArrayQueue<int, 4>;
+
+// Determines if an object lies within another object
+template <typename T, typename U>
+bool lies_within(T const& obj, U const& whole) {
+    auto const* p     = reinterpret_cast<std::byte const*>(&obj);
+    auto const* first = reinterpret_cast<std::byte const*>(&whole);
+    return first <= p && p < first + sizeof(U);
+}
+
+/* --- CORNER CASES --- */
+
+// Peek front, dequeue when empty --> throw
+TEST(SmallCircArrayQueueTest, PeekFrontOrDequeueWhenEmptyThrows) {
+    auto q = IntSmallCircArrayQueue();
+    EXPECT_THROW(q.front(), dsa::EmptyQueueError);
+    EXPECT_THROW(q.dequeue(), dsa::EmptyQueueError);
+}
+
+// Enqueue up to N --> inline; beyond N --> spill over to the free store
+TEST(SmallCircArrayQueueTest, EnqueueBeyondInlineCapacitySpills) {
+    auto q = IntSmallCircArrayQueue();
+    EXPECT_EQ(q.capacity(), 4);
+    for (int i { 0 }; i < 4; ++i) q.enqueue(i);
+    EXPECT_TRUE(q.is_inline());
+    EXPECT_TRUE(lies_within(q.front(), q));
+
+    q.enqueue(4);
+    EXPECT_FALSE(q.is_inline());
+    EXPECT_EQ(q.capacity(), 8);
+    EXPECT_FALSE(lies_within(q.front(), q));
+    EXPECT_EQ(q.to_string(), "[0 1 2 3 4]");
+}
+
+// Dequeue after spilling --> move back inline once shrunk to fit
+TEST(SmallCircArrayQueueTest, DequeueAfterSpillMovesBackInline) {
+    auto q = IntSmallCircArrayQueue();
+    for (int i { 0 }; i < 17; ++i) q.enqueue(i);
+    EXPECT_EQ(q.capacity(), 32);
+    while (q.size() > 3) q.dequeue();
+    EXPECT_FALSE(q.is_inline());
+    EXPECT_EQ(q.capacity(), 8);
+    q.dequeue();
+    q.dequeue();   // 1 * 4 < 8
+    EXPECT_TRUE(q.is_inline());
+    EXPECT_EQ(q.capacity(), 4);
+    EXPECT_EQ(q.to_string(), "[16]");
+}
+
+/* --- REGULAR CASES --- */
+
+// Enqueue, dequeue across the end of the inline slots --> FIFO order
+TEST(SmallCircArrayQueueTest, InlineSlotsWrapAround) {
+    auto q = dsa::SmallCircArrayQueue<std::string, 4, dsa::PowerOfTwoCapacity>();
+    int  next_in { 0 }, next_out { 0 };
+    for (int round { 0 }; round < 10; ++round) {
+        q.enqueue(std::to_string(next_in++));
+        q.enqueue(std::to_string(next_in++));
+        EXPECT_EQ(q.front(), std::to_string(next_out++));
+        q.dequeue();
+        EXPECT_EQ(q.front(), std::to_string(next_out++));
+        q.dequeue();
+    }
+    EXPECT_TRUE(q.empty());
+    EXPECT_TRUE(q.is_inline());
+}
+
+// Copy, move inline and spilled queues --> same elements in same order
+TEST(SmallCircArrayQueueTest, CopyAndMovePreserveElements) {
+    auto q = dsa::SmallCircArrayQueue<std::unique_ptr<int>, 2>();
+    q.emplace(std::make_unique<int>(3));
+    q.emplace(std::make_unique<int>(1));
+
+    auto moved = std::move(q);
+    EXPECT_TRUE(q.empty());
+    EXPECT_TRUE(moved.is_inline());
+    EXPECT_EQ(*moved.front(), 3);
+
+    moved.emplace(std::make_unique<int>(4));
+    q = std::move(moved);
+    EXPECT_FALSE(q.is_inline());
+    EXPECT_EQ(q.size(), 3);
+    EXPECT_TRUE(moved.empty());
+
+    auto nums = IntSmallCircArrayQueue();
+    for (int i { 0 }; i < 6; ++i) nums.enqueue(i);
+    auto copy = nums;
+    EXPECT_EQ(copy.to_string(), "[0 1 2 3 4 5]");
+    nums.dequeue();
+    nums.dequeue();
+    nums.dequeue();
+    copy = nums;
+    EXPECT_EQ(copy.to_string(), "[3 4 5]");
+}
@@ -0,0 +1,126 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstddef>   // size_t
+#include <memory>    // shared_ptr<T>, make_shared(), make_unique()
+#include <string>    // string
+#include <thread>    // thread, this_thread::yield()
+
+#include "spsc_ring_queue.hpp"
+
+using IntSPSCRingQueue = dsa::SPSCRingQueue<int>;
+
+/* --- CORNER CASES --- */
+
+// Peek front, dequeue when empty --> throw; try dequeue --> false
+TEST(SPSCRingQueueTest, PeekFrontOrDequeueWhenEmptyFails) {
+    auto q = IntSPSCRingQueue(4);
+    EXPECT_TRUE(q.empty());
+    EXPECT_THROW(q.front(), dsa::EmptyQueueError);
+    EXPECT_THROW(q.dequeue(), dsa::EmptyQueueError);
+    int out { -1 };
+    EXPECT_FALSE(q.try_dequeue(out));
+    EXPECT_EQ(out, -1);
+}
+
+// Enqueue when full --> throw; try enqueue --> false; capacity unchanged
+TEST(SPSCRingQueueTest, EnqueueWhenFullFails) {
+    auto q = IntSPSCRingQueue(3);   // rounded up to 4
+    EXPECT_EQ(q.capacity(), 4);
+    for (int i { 0 }; i < 4; ++i) EXPECT_TRUE(q.try_enqueue(i));
+    EXPECT_FALSE(q.try_enqueue(4));
+    EXPECT_THROW(q.enqueue(4), dsa::FullQueueError);
+    EXPECT_THROW(q.emplace(4), dsa::FullQueueError);
+    EXPECT_EQ(q.capacity(), 4);
+    EXPECT_EQ(q.to_string(), "[0 1 2 3]");
+}
+
+/* --- REGULAR CASES --- */
+
+// Drain and refill across the end of the array --> elements in FIFO order
+TEST(SPSCRingQueueTest, WrapAroundPreservesOrder) {
+    auto q = dsa::SPSCRingQueue<std::string>(4);
+    for (auto const* word : { "a", "b", "c", "d" }) q.enqueue(word);
+    q.dequeue();
+    q.dequeue();
+    EXPECT_TRUE(q.try_enqueue("e"));
+    q.emplace(1, 'f');
+    EXPECT_EQ(q.size(), 4);
+    EXPECT_EQ(q.front(), "c");
+    EXPECT_EQ(q.to_string(), "[c d e f]");
+
+    std::string out;
+    EXPECT_TRUE(q.try_dequeue(out));
+    EXPECT_EQ(out, "c");
+    EXPECT_EQ(q.size(), 3);
+}
+
+// Elements left in queue --> destroyed with the queue
+TEST(SPSCRingQueueTest, DestroysRemainingElements) {
+    auto elem = std::make_shared<int>(42);
+    {
+        auto q = dsa::SPSCRingQueue<std::shared_ptr<int>>(8);
+        for (int i { 0 }; i < 5; ++i) q.enqueue(elem);
+        q.dequeue();
+        EXPECT_EQ(elem.use_count(), 5);
+    }
+    EXPECT_EQ(elem.use_count(), 1);
+}
+
+// Producer and consumer on separate threads --> every element received once,
+// in order
+TEST(SPSCRingQueueTest, TransfersBetweenThreadsInOrder) {
+    constexpr std::size_t num_elems { 1 << 18 };
+    auto q = std::make_unique<dsa::SPSCRingQueue<std::size_t>>(64);
+
+    auto producer = std::thread { [&q] {
+        for (std::size_t i { 0 }; i < num_elems;) {
+            if (q->try_enqueue(i)) ++i;
+            else std::this_thread::yield();
+        }
+    } };
+
+    std::size_t num_out_of_order { 0 };
+    for (std::size_t i { 0 }, out { 0 }; i < num_elems;) {
+        if (!q->try_dequeue(out)) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (out != i++) ++num_out_of_order;
+    }
+    producer.join();
+
+    EXPECT_EQ(num_out_of_order, 0);
+    EXPECT_TRUE(q->empty());
+}
@@ -0,0 +1,119 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <string>   // string
+
+#include "static_circ_queue.hpp"
+
+using IntStaticCircQueue = dsa::StaticCircQueue<int, 4>;
+
+// Element type that has no default ctor
+struct Point
+{
+    int x, y;
+
+    constexpr Point(int x_, int y_) : x { x_ }, y { y_ } {}
+};
+
+// Fills up a queue, then drains and refills it across the end of the array,
+// all during constant evaluation
+constexpr int sum_after_wrap_around() {
+    auto q = dsa::StaticCircQueue<Point, 4> {};
+    for (int i { 0 }; i < 4; ++i) q.emplace(i, -i);
+    if (q.try_emplace(9, 9)) return -1;
+    q.dequeue();
+    q.dequeue();
+    q.try_enqueue(Point { 4, -4 });
+    q.try_enqueue(Point { 5, -5 });
+
+    int sum { 0 };
+    for (auto out = Point { 0, 0 }; q.try_dequeue(out);) sum += out.x;
+    return sum;
+}
+
+/* --- CORNER CASES --- */
+
+// Peek front, dequeue when empty --> throw; try dequeue --> false
+TEST(StaticCircQueueTest, PeekFrontOrDequeueWhenEmptyFails) {
+    auto q = IntStaticCircQueue();
+    EXPECT_THROW(q.front(), dsa::EmptyQueueError);
+    EXPECT_THROW(q.dequeue(), dsa::EmptyQueueError);
+    int out { -1 };
+    EXPECT_FALSE(q.try_dequeue(out));
+    EXPECT_EQ(out, -1);
+}
+
+// Enqueue when full --> throw; try enqueue --> false; capacity unchanged
+TEST(StaticCircQueueTest, EnqueueWhenFullFails) {
+    auto q = IntStaticCircQueue();
+    for (int i { 0 }; i < 4; ++i) EXPECT_TRUE(q.try_enqueue(i));
+    EXPECT_TRUE(q.full());
+    EXPECT_FALSE(q.try_enqueue(4));
+    EXPECT_THROW(q.enqueue(4), dsa::FullQueueError);
+    EXPECT_THROW(q.emplace(4), dsa::FullQueueError);
+    EXPECT_EQ(q.capacity(), 4);
+    EXPECT_EQ(q.to_string(), "[0 1 2 3]");
+}
+
+/* --- REGULAR CASES --- */
+
+// Use in constant expression --> evaluated at compile time
+TEST(StaticCircQueueTest, UsableInConstantExpressions) {
+    static_assert(sum_after_wrap_around() == 2 + 3 + 4 + 5);
+    static_assert(IntStaticCircQueue::capacity() == 4);
+    EXPECT_EQ(sum_after_wrap_around(), 14);
+}
+
+// Copy, move a wrapped queue --> same elements in same order
+TEST(StaticCircQueueTest, CopyAndMovePreserveOrder) {
+    auto q = dsa::StaticCircQueue<std::string, 4>();
+    for (auto const* word : { "a", "b", "c", "d" }) q.enqueue(word);
+    q.dequeue();
+    q.dequeue();
+    q.enqueue("e");   // wraps around
+
+    auto copy = q;
+    EXPECT_EQ(copy.to_string(), "[c d e]");
+
+    auto moved = dsa::StaticCircQueue<std::string, 4>();
+    moved.enqueue("z");
+    moved = std::move(copy);
+    EXPECT_EQ(moved.to_string(), "[c d e]");
+    EXPECT_EQ(q.to_string(), "[c d e]");
+
+    std::string out;
+    EXPECT_TRUE(moved.try_dequeue(out));
+    EXPECT_EQ(out, "c");
+    EXPECT_EQ(moved.size(), 2);
+}
@@ -0,0 +1,144 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>    // atomic<T>
+#include <cstddef>   // size_t
+#include <thread>    // thread, this_thread::yield()
+#include <vector>    // vector<T>
+
+#include "work_stealing_deque.hpp"
+
+using IntWorkStealingDeque = dsa::WorkStealingDeque<int>;
+
+/* --- CORNER CASES --- */
+
+// Pop or steal when empty --> false; output left untouched
+TEST(WorkStealingDequeTest, PopOrStealWhenEmptyFails) {
+    auto dq = IntWorkStealingDeque();
+    EXPECT_TRUE(dq.empty());
+    int out { -1 };
+    EXPECT_FALSE(dq.try_pop(out));
+    EXPECT_FALSE(dq.try_steal(out));
+    EXPECT_EQ(out, -1);
+
+    dq.push(0);
+    EXPECT_TRUE(dq.try_pop(out));
+    EXPECT_FALSE(dq.try_pop(out));
+    EXPECT_FALSE(dq.try_steal(out));
+    EXPECT_TRUE(dq.empty());
+}
+
+// Push when full --> capacity doubled, elements kept across the end of the
+// array
+TEST(WorkStealingDequeTest, PushWhenFullGrows) {
+    auto dq = IntWorkStealingDeque(3);   // raised to 4
+    EXPECT_EQ(dq.capacity(), 4);
+    int out;
+    for (int i { 0 }; i < 3; ++i) dq.push(i);
+    EXPECT_TRUE(dq.try_steal(out));   // top now off the start of the array
+    for (int i { 3 }; i < 10; ++i) dq.push(i);
+    EXPECT_EQ(dq.capacity(), 16);
+    EXPECT_EQ(dq.size(), 9);
+    for (int i { 1 }; i < 5; ++i) {
+        EXPECT_TRUE(dq.try_steal(out));
+        EXPECT_EQ(out, i);
+    }
+    for (int i { 9 }; i >= 5; --i) {
+        EXPECT_TRUE(dq.try_pop(out));
+        EXPECT_EQ(out, i);
+    }
+    EXPECT_TRUE(dq.empty());
+}
+
+/* --- REGULAR CASES --- */
+
+// Pop and steal --> most recent element popped, least recent stolen
+TEST(WorkStealingDequeTest, PopsNewestAndStealsOldest) {
+    auto dq = IntWorkStealingDeque();
+    for (int i { 0 }; i < 4; ++i) dq.push(i);
+    int out;
+    EXPECT_TRUE(dq.try_pop(out));
+    EXPECT_EQ(out, 3);
+    EXPECT_TRUE(dq.try_steal(out));
+    EXPECT_EQ(out, 0);
+    EXPECT_TRUE(dq.try_pop(out));
+    EXPECT_EQ(out, 2);
+    EXPECT_TRUE(dq.try_steal(out));
+    EXPECT_EQ(out, 1);
+    EXPECT_EQ(dq.size(), 0);
+}
+
+// Owner pushes and pops while thieves steal --> every element taken exactly
+// once
+TEST(WorkStealingDequeTest, TakesEveryElementExactlyOnce) {
+    constexpr std::size_t num_thieves { 3 };
+    constexpr std::size_t num_elems { 1 << 16 };
+    auto dq = dsa::WorkStealingDeque<std::size_t>(2);
+
+    auto seen     = std::vector<std::atomic<int>>(num_elems);
+    auto num_left = std::atomic<std::size_t> { num_elems };
+    auto thieves  = std::vector<std::thread> {};
+    for (std::size_t t { 0 }; t < num_thieves; ++t) {
+        thieves.emplace_back([&dq, &seen, &num_left] {
+            while (num_left.load() > 0) {
+                std::size_t out;
+                if (!dq.try_steal(out)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                seen[out].fetch_add(1);
+                num_left.fetch_sub(1);
+            }
+        });
+    }
+    for (std::size_t i { 0 }; i < num_elems; ++i) {
+        dq.push(i);
+        // Pops every other element, racing with the thieves for the last one
+        std::size_t out;
+        if (i % 2 == 1 && dq.try_pop(out)) {
+            seen[out].fetch_add(1);
+            num_left.fetch_sub(1);
+        }
+    }
+    for (std::size_t out; dq.try_pop(out);) {
+        seen[out].fetch_add(1);
+        num_left.fetch_sub(1);
+    }
+    for (auto& thief : thieves) thief.join();
+
+    std::size_t num_not_seen_once { 0 };
+    for (auto const& count : seen) num_not_seen_once += count.load() != 1;
+    EXPECT_EQ(num_not_seen_once, 0);
+    EXPECT_TRUE(dq.empty());
+}
@@ -0,0 +1,146 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2022, KriztoferY (https://github.com/KriztoferY)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>      // atomic<T>
+#include <cstddef>     // size_t
+#include <stdexcept>   // runtime_error
+#include <string>      // string
+#include <vector>      // vector<T>
+
+#include "work_stealing_executor.hpp"
+
+// Job after the one in the merge demo, whose task is to sum a range of
+// numbers, splitting the range into subjobs while it is large
+struct Job
+{
+    unsigned int time_id;
+    unsigned int priority { 0 };
+    std::string  name { "unnamed" };
+};
+
+/* --- CORNER CASES --- */
+
+// Create with no workers --> one worker
+TEST(WorkStealingExecutorTest, CreateWithNoWorkersStartsOne) {
+    auto pool = dsa::WorkStealingExecutor(0);
+    EXPECT_EQ(pool.num_workers(), 1);
+    auto ran = std::atomic<bool> { false };
+    pool.submit([&ran] { ran.store(true); });
+    pool.wait();
+    EXPECT_TRUE(ran.load());
+}
+
+// Wait with nothing submitted --> returns at once
+TEST(WorkStealingExecutorTest, WaitWhenIdleReturns) {
+    auto pool = dsa::WorkStealingExecutor(2);
+    pool.wait();
+    pool.wait();
+}
+
+// Task throws --> first exception rethrown by wait, once; other tasks run
+TEST(WorkStealingExecutorTest, WaitRethrowsTaskException) {
+    auto pool    = dsa::WorkStealingExecutor(2);
+    auto num_ran = std::atomic<int> { 0 };
+    pool.submit([] { throw std::runtime_error { "task failed" }; });
+    for (int i { 0 }; i < 8; ++i) {
+        pool.submit([&num_ran] { num_ran.fetch_add(1); });
+    }
+    EXPECT_THROW(pool.wait(), std::runtime_error);
+    EXPECT_EQ(num_ran.load(), 8);
+    pool.wait();
+}
+
+// Destroy with tasks pending --> all of them run first
+TEST(WorkStealingExecutorTest, DestroyRunsPendingTasks) {
+    auto num_ran = std::atomic<int> { 0 };
+    {
+        auto pool = dsa::WorkStealingExecutor(2);
+        for (int i { 0 }; i < 64; ++i) {
+            pool.submit([&num_ran] { num_ran.fetch_add(1); });
+        }
+    }
+    EXPECT_EQ(num_ran.load(), 64);
+}
+
+/* --- REGULAR CASES --- */
+
+// Submit jobs from outside the pool --> every job run exactly once
+TEST(WorkStealingExecutorTest, RunsEveryJobExactlyOnce) {
+    constexpr unsigned int num_jobs { 1 << 12 };
+    auto pool = dsa::WorkStealingExecutor(4);
+    auto seen = std::vector<std::atomic<int>>(num_jobs);
+    for (unsigned int i { 0 }; i < num_jobs; ++i) {
+        pool.submit([&seen, job = Job { i, i % 3, "job" }] {
+            seen[job.time_id].fetch_add(1);
+        });
+    }
+    pool.wait();
+
+    std::size_t num_not_seen_once { 0 };
+    for (auto const& count : seen) num_not_seen_once += count.load() != 1;
+    EXPECT_EQ(num_not_seen_once, 0);
+}
+
+// Jobs that submit subjobs --> subjobs run before wait returns
+TEST(WorkStealingExecutorTest, RunsJobsSubmittedByJobs) {
+    constexpr std::size_t num_elems { 1 << 16 };
+    constexpr std::size_t grain_size { 64 };
+    auto pool = dsa::WorkStealingExecutor(4);
+    auto sum  = std::atomic<std::size_t> { 0 };
+
+    // Sums the numbers in [first, last)
+    struct SumJob
+    {
+        dsa::WorkStealingExecutor* pool;
+        std::atomic<std::size_t>*  sum;
+        std::size_t                first;
+        std::size_t                last;
+
+        void operator()() const {
+            if (last - first <= grain_size) {
+                std::size_t partial { 0 };
+                for (auto i = first; i < last; ++i) partial += i;
+                sum->fetch_add(partial);
+                return;
+            }
+            auto const mid = first + (last - first) / 2;
+            pool->submit(SumJob { pool, sum, first, mid });
+            pool->submit(SumJob { pool, sum, mid, last });
+        }
+    };
+
+    pool.submit(SumJob { &pool, &sum, 0, num_elems });
+    pool.wait();
+    EXPECT_EQ(sum.load(), num_elems * (num_elems - 1) / 2);
+}